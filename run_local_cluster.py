@@ -0,0 +1,130 @@
+# run a whole cluster on the local host
+# example usage
+# python3 run_local_cluster.py CONFIG=exp_profiles/test_local_cluster.json [
+# optional args]
+# NUM_NODES compute nodes and NUM_STORAGE_NODES storage nodes are started as
+# separate processes listening on 127.0.0.1. They reach each other over the
+# loopback interface and share the log device of the profile (e.g. a local
+# redis server, given by REDIS_ADDR). Network delays are emulated by the rpc
+# client (NET_EMU_LATENCY, NET_EMU_JITTER, NET_EMU_BANDWIDTH).
+# As in run_exp.py, any param with a list as values issues one run per value.
+# The output of node i is written to outputs/local-<i>.out and the stats of
+# each run are appended to outputs/stats.json.
+# run() optionally checks the outputs of the nodes before they are parsed
+# (e.g. tests/test_failure/test_early_ack.py).
+import os, sys, re, json
+import subprocess
+import time
+
+from run_exp import load_job, generate_args, parse_output
+
+repo = os.path.dirname(os.path.abspath(__file__)) + "/"
+ifconfig = "ifconfig_local.txt"
+base_port = 50051
+
+
+def exec(cmd, exit_on_err=True):
+    print("[run_local_cluster.py] executing: " + cmd, flush=True)
+    ret = subprocess.run(cmd, shell=True).returncode
+    if ret != 0 and exit_on_err:
+        print("[run_local_cluster.py] error executing: {}".format(cmd))
+        exit(1)
+    return ret
+
+
+def build_config(job, dest="src/config.h"):
+    s = open(repo + "src/config-std.h").read()
+    for (param, value) in job.items():
+        pattern = r"\#define\s*" + re.escape(param) + r'\s.*'
+        replacement = "#define " + param + ' ' + str(value)
+        s = re.sub(pattern, replacement, s)
+    open(repo + dest, 'w').write(s)
+
+
+def write_ifconfig(num_nodes, num_storage_nodes, redis_addr):
+    f = open(repo + "src/" + ifconfig, 'w')
+    f.write("# generated by run_local_cluster.py\n")
+    for i in range(num_nodes):
+        f.write("127.0.0.1:{}\n".format(base_port + i))
+    f.write("=l\n")
+    f.write(redis_addr + "\n")
+    f.write("=s\n")
+    for i in range(num_storage_nodes):
+        f.write("127.0.0.1:{}\n".format(base_port + num_nodes + i))
+    f.close()
+
+
+def compile(job, num_storage_nodes):
+    bin_dir = repo + "outputs/local_cluster/"
+    os.makedirs(bin_dir, exist_ok=True)
+    # both binaries are built from the same objects; build them one by one.
+    if num_storage_nodes > 0:
+        job["NODE_TYPE"] = "STORAGE_NODE"
+        build_config(job)
+        exec("cd {}src; make clean; make -j{} runstorage > {}temp.out 2>&1"
+             .format(repo, os.cpu_count(), bin_dir))
+        exec("mv {}src/runstorage {}".format(repo, bin_dir))
+    job["NODE_TYPE"] = "COMPUTE_NODE"
+    build_config(job)
+    exec("cd {}src; make clean; make -j{} rundb > {}temp.out 2>&1"
+         .format(repo, os.cpu_count(), bin_dir))
+    exec("mv {}src/rundb {}".format(repo, bin_dir))
+    return bin_dir
+
+
+def run(job, check=None):
+    num_nodes = int(job.get("NUM_NODES", 1))
+    num_storage_nodes = int(job.get("NUM_STORAGE_NODES", 0))
+    job["DISTRIBUTED"] = "true" if num_nodes > 1 else "false"
+    write_ifconfig(num_nodes, num_storage_nodes,
+                   job.pop("REDIS_ADDR", "127.0.0.1:6379 sundial-dev"))
+    bin_dir = compile(job, num_storage_nodes)
+
+    os.chdir(repo + "src")
+    storage = []
+    for i in range(num_storage_nodes):
+        storage.append(subprocess.Popen(
+            "{}runstorage -Gn{} -Df {} > {}outputs/local-storage-{}.out 2>&1"
+            .format(bin_dir, i, ifconfig, repo, i), shell=True))
+    nodes = []
+    for i in range(num_nodes):
+        nodes.append(subprocess.Popen(
+            "{}rundb -Gn{} -Df {} > {}outputs/local-{}.out 2>&1"
+            .format(bin_dir, i, ifconfig, repo, i), shell=True))
+    failed = False
+    for i, p in enumerate(nodes):
+        if p.wait() != 0:
+            print("[run_local_cluster.py] node {} failed".format(i))
+            failed = True
+    # compute node 0 terminates the storage nodes; do not wait for stragglers.
+    time.sleep(1)
+    for p in storage:
+        p.kill()
+    os.chdir(repo)
+    if check and not failed and not check(
+            ["{}outputs/local-{}.out".format(repo, i) for i in range(num_nodes)]):
+        failed = True
+
+    throughput = 0
+    for i in range(num_nodes):
+        job["NODE_ID"] = i
+        fname = "{}outputs/local-{}.out".format(repo, i)
+        result = dict(job)
+        if failed or not parse_output({"repo": repo}, result, fname):
+            print("[run_local_cluster.py] no stats in {}".format(fname))
+            continue
+        throughput += float(result.get("Throughput", 0))
+    print("[run_local_cluster.py] total throughput: {}".format(throughput),
+          flush=True)
+    return not failed
+
+
+if __name__ == "__main__":
+    os.makedirs(repo + "outputs", exist_ok=True)
+    job = load_job(sys.argv[1:])
+    ok = True
+    for i, arg in enumerate(generate_args(job)):
+        arg += " EXP_ID={}".format(i)
+        print("[run_local_cluster.py] arg = {}".format(arg), flush=True)
+        ok = run(load_job(arg.split())) and ok
+    sys.exit(0 if ok else 1)
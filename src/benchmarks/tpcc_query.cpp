@@ -76,6 +76,14 @@ QueryPaymentTPCC::QueryPaymentTPCC(char * data)
     //memcpy(this, data, sizeof(*this));
 }
 
+void
+QueryPaymentTPCC::get_write_keys(std::vector<std::pair<uint32_t, uint64_t> > &keys)
+{
+    QueryTPCC::get_write_keys(keys);
+    if (c_w_id != w_id && TPCCHelper::wh_to_node(c_w_id) == g_node_id)
+        keys.push_back(std::make_pair((uint32_t) TAB_WAREHOUSE, c_w_id));
+}
+
 ///////////////////////////////////////////
 // New Order
 ///////////////////////////////////////////
@@ -135,6 +143,18 @@ QueryNewOrderTPCC::~QueryNewOrderTPCC()
     delete [] items;
 }
 
+void
+QueryNewOrderTPCC::get_write_keys(std::vector<std::pair<uint32_t, uint64_t> > &keys)
+{
+    QueryTPCC::get_write_keys(keys);
+    // stock rows of the supplying warehouses
+    for (uint32_t i = 0; i < ol_cnt; i ++) {
+        uint64_t supply_w_id = items[i].ol_supply_w_id;
+        if (supply_w_id != w_id && TPCCHelper::wh_to_node(supply_w_id) == g_node_id)
+            keys.push_back(std::make_pair((uint32_t) TAB_WAREHOUSE, supply_w_id));
+    }
+}
+
 uint32_t
 QueryNewOrderTPCC::serialize(char * &raw_data)
 {
@@ -3,6 +3,7 @@
 #include "global.h"
 #include "helper.h"
 #include "query.h"
+#include "tpcc_const.h"
 
 class workload;
 
@@ -20,6 +21,10 @@ public:
     QueryTPCC();
     QueryTPCC(QueryTPCC * query);
     virtual ~QueryTPCC() {};
+    // the full access set is not known before execution (e.g., customer by
+    // last name), so the local warehouses a query touches stand for it.
+    virtual void get_write_keys(std::vector<std::pair<uint32_t, uint64_t> > &keys)
+    { keys.push_back(std::make_pair((uint32_t) TAB_WAREHOUSE, w_id)); }
     uint32_t type;
 
     uint64_t w_id;
@@ -42,6 +47,7 @@ public:
         h_amount = query->h_amount;
     };
     QueryPaymentTPCC(char * data);
+    void get_write_keys(std::vector<std::pair<uint32_t, uint64_t> > &keys);
 
     uint64_t d_w_id;
     uint64_t c_w_id;
@@ -66,6 +72,7 @@ public:
     }
     QueryNewOrderTPCC(char * data);
     ~QueryNewOrderTPCC();
+    void get_write_keys(std::vector<std::pair<uint32_t, uint64_t> > &keys);
 
     uint32_t serialize(char * &raw_data);
 
@@ -85,6 +92,7 @@ public:
         by_last_name = query->by_last_name;
         memcpy(c_last, query->c_last, LASTNAME_LEN);
     }
+    bool is_read_only() { return true; }
 
     bool by_last_name;
     char c_last[LASTNAME_LEN];
@@ -115,6 +123,7 @@ public:
     {
         threshold = query->threshold;
     }
+    bool is_read_only() { return true; }
 
     int64_t threshold;
 };
@@ -68,6 +68,21 @@ TPCCStoreProcedure::execute_payment()
 
     uint64_t c_w_id = query->c_w_id;
 
+#if PIPELINED_REMOTE_READS
+    // the remote customer is read while WAREHOUSE and DISTRICT are accessed.
+    if (TPCCHelper::wh_to_node(c_w_id) != g_node_id) {
+        clear_remote_requests();
+        add_remote_request(TPCCHelper::wh_to_node(c_w_id),
+            (query->by_last_name)?
+                custNPKey(query->c_last, query->c_d_id, query->c_w_id)
+                : custKey(query->c_w_id, query->c_d_id, query->c_id),
+            (query->by_last_name)? IDX_CUSTOMER_LAST : IDX_CUSTOMER_ID,
+            TAB_CUSTOMER, WR);
+        rc = _txn->send_remote_package_async(remote_requests);
+        if (rc == ABORT || rc == FAIL) return rc;
+    }
+#endif
+
     // Step 1: access WAREHOUSE
     // ========================
     key = query->w_id;
@@ -127,8 +142,12 @@ TPCCStoreProcedure::execute_payment()
     if (node_id == g_node_id) {
         GET_DATA(key, index, WR);
     } else {
+#if PIPELINED_REMOTE_READS
+        rc = _txn->wait_remote_package();
+#else
         uint32_t index_id = (query->by_last_name)? IDX_CUSTOMER_LAST : IDX_CUSTOMER_ID;
         rc = _txn->send_remote_read_request(node_id, key, index_id, TAB_CUSTOMER, WR);
+#endif
         if (rc == ABORT) return rc;
     }
 
@@ -180,6 +199,21 @@ TPCCStoreProcedure::execute_new_order()
     uint64_t ol_cnt = query->ol_cnt;
     Item_no * items = query->items;
 
+#if PIPELINED_REMOTE_READS
+    // send the reads of all remote stocks now; they are waited for at Step 7.
+    clear_remote_requests();
+    for (uint64_t i = 0; i < ol_cnt; i ++) {
+        uint32_t node_id = TPCCHelper::wh_to_node(items[i].ol_supply_w_id);
+        if (node_id != g_node_id)
+            add_remote_request(node_id, stockKey(items[i].ol_supply_w_id,
+                items[i].ol_i_id), IDX_STOCK, TAB_STOCK, WR);
+    }
+    if (remote_requests.size() > 0) {
+        rc = _txn->send_remote_package_async(remote_requests);
+        if (rc == ABORT || rc == FAIL) return rc;
+    }
+
+#endif
     // Step 1: access WAREHOUSE
     // ========================
     //    EXEC SQL SELECT c_discount, c_last, c_credit, w_tax
@@ -283,20 +317,28 @@ TPCCStoreProcedure::execute_new_order()
     }
     // Step 7: access STOCK
     // ====================
+#if PIPELINED_REMOTE_READS
+    if (remote_requests.size() > 0) {
+        rc = _txn->wait_remote_package();
+        if (rc == ABORT) return rc;
+    }
+#endif
     for (_curr_ol_number = 0; _curr_ol_number < ol_cnt; _curr_ol_number ++) {
         Item_no * it = &items[_curr_ol_number];
         key = stockKey(it->ol_supply_w_id, it->ol_i_id);
 
         // TODO. if any access is remote, the current thread blocks until
-        // the response come back. This can be implemented using asynchronous
-        // RPC. E.g., make multiple RPC calls and then wait for them one by one.
+        // the response come back. With PIPELINED_REMOTE_READS, the remote
+        // stocks were already read above.
         schema = wl->t_stock->get_schema();
         uint32_t node_id = TPCCHelper::wh_to_node( it->ol_supply_w_id);
         if (node_id == g_node_id) {
             GET_DATA(key, wl->i_stock, WR);
         } else {
+#if !PIPELINED_REMOTE_READS
             rc = _txn->send_remote_read_request(node_id, key, IDX_STOCK, TAB_STOCK, WR);
             if (rc == ABORT) return rc;
+#endif
         }
 
         char * _curr_data = get_cc_manager()->get_data(key, TAB_STOCK);
@@ -75,6 +75,10 @@ QueryYCSB::QueryYCSB(RequestYCSB * requests, uint32_t num_requests)
     _request_cnt = num_requests;
     _requests = (RequestYCSB *) MALLOC(sizeof(RequestYCSB) * _request_cnt);
     memcpy(_requests, requests, sizeof(RequestYCSB) * _request_cnt);
+    _is_read_only = true;
+    for (uint32_t i = 0; i < _request_cnt; i++)
+        if (_requests[i].rtype != RD)
+            _is_read_only = false;
 }
 
 QueryYCSB::~QueryYCSB()
@@ -88,6 +92,7 @@ void QueryYCSB::gen_requests() {
     uint64_t all_keys[64];
     bool has_remote = false;
     _is_all_remote_readonly = true;
+    _is_read_only = true;
     uint64_t table_size = g_synth_table_size;
     for (uint32_t tmp = 0; tmp < g_req_per_query; tmp ++) {
         RequestYCSB * req = &_requests[_request_cnt];
@@ -118,6 +123,8 @@ void QueryYCSB::gen_requests() {
         }
         if (req->rtype == WR && remote)
             _is_all_remote_readonly = false;
+        if (req->rtype == WR)
+            _is_read_only = false;
 
         #if SOCIAL_NETWORK
         // if this switch is turned on, we mimic a social network
@@ -165,6 +172,24 @@ void QueryYCSB::gen_requests() {
     }
 }
 
+void
+QueryYCSB::get_read_keys(std::vector<std::pair<uint32_t, uint64_t> > &keys)
+{
+    for (uint32_t i = 0; i < _request_cnt; i ++)
+        if (_requests[i].rtype == RD
+            && GET_WORKLOAD->key_to_node(_requests[i].key) == g_node_id)
+            keys.push_back(std::make_pair(0, _requests[i].key));
+}
+
+void
+QueryYCSB::get_write_keys(std::vector<std::pair<uint32_t, uint64_t> > &keys)
+{
+    for (uint32_t i = 0; i < _request_cnt; i ++)
+        if (_requests[i].rtype == WR
+            && GET_WORKLOAD->key_to_node(_requests[i].key) == g_node_id)
+            keys.push_back(std::make_pair(0, _requests[i].key));
+}
+
 uint32_t
 QueryYCSB::serialize(char * &raw_data)
 {
@@ -28,6 +28,9 @@ public:
     RequestYCSB * get_requests()    { return _requests; }
     void gen_requests();
     bool is_all_remote_readonly() { return _is_all_remote_readonly; }
+    bool is_read_only() { return _is_read_only; }
+    void get_read_keys(std::vector<std::pair<uint32_t, uint64_t> > &keys);
+    void get_write_keys(std::vector<std::pair<uint32_t, uint64_t> > &keys);
 
 private:
     uint32_t _request_cnt;
@@ -40,4 +43,5 @@ private:
     static double denom;
     static double zeta_2_theta;
     bool _is_all_remote_readonly;
+    bool _is_read_only;
 };
@@ -58,28 +58,24 @@ YCSBStoreProcedure::execute()
     // Phase 0: figure out whether we need remote queries; if so, send messages.
     // for each request, if it touches a remote node, add it to a remote query.
     // bool has_remote_req = false;
-    remote_requests.clear();
+    clear_remote_requests();
     for (uint32_t i = 0; i < query->get_request_count(); i ++) {
         RequestYCSB * req = &requests[i];
         uint32_t home_node = GET_WORKLOAD->key_to_node(req->key);
-        if (home_node != g_node_id) {
-            if (remote_requests.find(home_node) == remote_requests.end())
-                remote_requests.insert(std::pair<uint64_t, vector<RemoteRequestInfo *> >
-                    (home_node, vector<RemoteRequestInfo *>()));
-            // TODO. Ideally, we should send SQL or some other intermediate representation of the query over.
-            // For now, we just send the message using the following format (RemoteQuery)
-            //        | key | index_id | type | [optional] cc_specific_data |
-            RemoteRequestInfo * remote_request = new RemoteRequestInfo;
-            remote_request->access_type = req->rtype;
-            remote_request->index_id = 0;
-            remote_request->key = req->key;
-            remote_request->table_id = 0;
-            remote_requests[home_node].push_back(remote_request);
-        }
+        // TODO. Ideally, we should send SQL or some other intermediate representation of the query over.
+        // For now, we just send the message using the following format (RemoteQuery)
+        //        | key | index_id | type | [optional] cc_specific_data |
+        if (home_node != g_node_id)
+            add_remote_request(home_node, req->key, 0, 0, req->rtype);
     }
     // send remote package, if abort return abort
     if (remote_requests.size() > 0) {
+#if PIPELINED_REMOTE_READS
+        // the remote reads are in flight while the local rows are accessed.
+        rc = _txn->send_remote_package_async(remote_requests);
+#else
         rc = _txn->send_remote_package(remote_requests);
+#endif
         if (rc == ABORT || rc == FAIL) return rc;
     }
 
@@ -95,6 +91,13 @@ YCSBStoreProcedure::execute()
         }
     }
 
+#if PIPELINED_REMOTE_READS
+    if (remote_requests.size() > 0) {
+        rc = _txn->wait_remote_package();
+        if (rc == ABORT) return rc;
+    }
+#endif
+
     // Phase 2: after all data is acquired, finish the rest of the transaction.
     // all the data is here. Do computation and commit.
     for (uint32_t i = 0; i < query->get_request_count(); i ++) {
@@ -19,7 +19,7 @@ LockManager::LockManager(TxnManager * txn)
 {
     _num_lock_waits = 0;
 #if CC_ALG == WAIT_DIE
-    assert(g_ts_alloc == TS_CLOCK);
+    assert(g_ts_alloc == TS_CLOCK || g_ts_alloc == TS_HLC);
     _timestamp = glob_manager->get_ts(GET_THD_ID);
 #endif
 #if WORKLOAD == TPCC
@@ -34,8 +34,10 @@ LockManager::get_row(row_t * row, access_t type, uint64_t key)
     assert(type == RD || type == WR);
     _num_lock_waits = 0;
 
+#if !DETERMINISTIC
     Row_lock::LockType lock_type = (type == RD)? Row_lock::LOCK_SH : Row_lock::LOCK_EX;
     rc = row->manager->lock_get(lock_type, _txn);
+#endif
     if (rc == RCOK) {
         if (type == WR) _txn->set_read_only(false);
         // For now, assume get_row() will not be called if the record is already
@@ -111,17 +113,21 @@ LockManager::index_get_permission(access_t type, INDEX * index, uint64_t key, ui
                 assert( (ac->type == RD)
                             && (type == INS || type == DEL) );
                 ac->type = type;
+#if !DETERMINISTIC
                 rc = ac->manager->lock_get(Row_lock::LOCK_EX, _txn);
+#endif
                 return rc;
             }
         }
     }
 
     Row_lock * manager = index->index_get_manager(key);
+#if !DETERMINISTIC
     if (type == RD)
         rc = manager->lock_get(Row_lock::LOCK_SH, _txn, false);
     else // if (type == INS || type == DEL)
         rc = manager->lock_get(Row_lock::LOCK_EX, _txn, false);
+#endif
     manager->unlatch();
     if (rc == ABORT) return ABORT;
     // NOTE
@@ -229,10 +235,12 @@ LockManager::cleanup(RC rc)
 {
     assert(rc == COMMIT || rc == ABORT);
     if (rc == ABORT) {
+#if !DETERMINISTIC
         for (const auto& access : _access_set)
             access.row->manager->lock_release(_txn, rc);
         for (auto access : _index_access_set)
             access.manager->lock_release(_txn, rc);
+#endif
     } else { // rc == COMMIT
 #if !EARLY_LOCK_RELEASE
         commit_insdel();
@@ -242,11 +250,15 @@ LockManager::cleanup(RC rc)
             if (access.type == WR)
                 access.row->copy(access.data);
 #endif
+#if !DETERMINISTIC
             access.row->manager->lock_release(_txn, rc);
+#endif
         }
+#if !DETERMINISTIC
         for (auto access : _index_access_set) {
             access.manager->lock_release(_txn, rc);
         }
+#endif
     }
     for (const auto& access : _access_set) {
         assert(access.data);
@@ -304,7 +316,7 @@ LockManager::process_remote_read_response(uint32_t node_id, access_t type, Sundi
         access->type = type;
         access->data_size = response.tuple_data(i).size();
         access->data = new char [access->data_size];
-        memcpy(access->data, response.tuple_data(i).data().c_str(), access->data_size);
+        copy_tuple_payload(access->data, response.tuple_data(i).data(), access->data_size);
     }
 }
 
@@ -325,7 +337,7 @@ LockManager::process_remote_read_response(uint32_t node_id, SundialResponse &res
         access->type = (access_t) response.tuple_data(i).access_type();
         access->data_size = response.tuple_data(i).size();
         access->data = new char [access->data_size];
-        memcpy(access->data, response.tuple_data(i).data().c_str(), access->data_size);
+        copy_tuple_payload(access->data, response.tuple_data(i).data(), access->data_size);
     }
 }
 
@@ -339,7 +351,7 @@ LockManager::build_prepare_req(uint32_t node_id, SundialRequest &request)
             tuple->set_key(access.key);
             tuple->set_table_id( access.table_id );
             tuple->set_size( tuple_size );
-            tuple->set_data( access.data, tuple_size );
+            set_tuple_payload( tuple, access.data, tuple_size );
         }
     }
 }
@@ -0,0 +1,369 @@
+#include "maat_manager.h"
+#include "manager.h"
+#include "txn.h"
+#include "row_maat.h"
+#include "time_table.h"
+#include "row.h"
+#include "index_base.h"
+#include "table.h"
+#include "index_hash.h"
+#include "query.h"
+#include "workload.h"
+#include "store_procedure.h"
+#include "txn_table.h"
+
+#if CC_ALG == MAAT
+
+MaaTManager::MaaTManager(TxnManager * txn)
+    : CCManager(txn)
+{
+    _in_time_table = false;
+    _lower = 0;
+    _upper = UINT64_MAX;
+#if WORKLOAD == TPCC
+    _access_set.reserve(128);
+#endif
+}
+
+void
+MaaTManager::init_time_table()
+{
+    // txn id is only assigned after the manager is created.
+    if (!_in_time_table) {
+        time_table->init(_txn->get_txn_id());
+        _in_time_table = true;
+        _lower = 0;
+        _upper = UINT64_MAX;
+    }
+}
+
+RC
+MaaTManager::get_row(row_t * row, access_t type, uint64_t key)
+{
+    RC rc = RCOK;
+    assert(type == RD || type == WR);
+    init_time_table();
+
+    AccessMaaT ac;
+    _access_set.push_back( ac );
+    AccessMaaT * access = &(*_access_set.rbegin());
+    access->key = key;
+    access->home_node_id = g_node_id;
+    access->table_id = row->get_table()->get_table_id();
+    access->type = type;
+    access->row = row;
+    access->data = new char [row->get_tuple_size()];
+    access->data_size = row->get_tuple_size();
+    if (type == RD) {
+        rc = row->manager->read(_txn, access->data, access->wts,
+                                access->uncommitted_writes);
+    } else {
+        rc = row->manager->prewrite(_txn, access->data, access->wts, access->rts,
+                                    access->uncommitted_reads,
+                                    access->uncommitted_writes);
+        _txn->set_read_only(false);
+    }
+    return rc;
+}
+
+RC
+MaaTManager::get_row(row_t * row, access_t type, char * &data, uint64_t key)
+{
+    RC rc = get_row(row, type, key);
+    if (rc == RCOK) {
+        data = _access_set.rbegin()->data;
+        assert(data);
+    }
+    return rc;
+}
+
+char *
+MaaTManager::get_data(uint64_t key, uint32_t table_id)
+{
+    for (auto & it : _access_set)
+        if (it.key == key && it.table_id == table_id)
+            return it.data;
+
+    for (auto & it : _remote_set)
+        if (it.key == key && it.table_id == table_id)
+            return it.data;
+
+    // data not found
+    assert(false);
+    return nullptr;
+}
+
+RC
+MaaTManager::index_get_permission(access_t type, INDEX * index, uint64_t key, uint32_t limit)
+{
+    RC rc = RCOK;
+    assert(type == RD || type == INS || type == DEL);
+    if (type == INS || type == DEL) _txn->set_read_only(false);
+
+    // if already accessed
+    for (uint32_t i = 0; i < _index_access_set.size(); i++) {
+        IndexAccess * ac = &_index_access_set[i];
+        if ( ac->index == index && ac->key == key )  {
+            if (ac->type == type) {
+                ac->rows = index->read(key);
+            } else {
+                assert( (ac->type == RD)
+                            && (type == INS || type == DEL) );
+                ac->type = type;
+            }
+            return rc;
+        }
+    }
+
+    // latch was taken by the manager
+    // to protect the atomicity of read / insert / delete index
+    ROW_MAN * manager = index->index_get_manager(key);
+    IndexAccess access;
+    if (type == RD)
+        access.rows = index->read(key);
+    manager->unlatch();
+
+    access.key = key;
+    access.index = index;
+    access.type = type;
+    access.manager = manager;
+    _index_access_set.push_back(access);
+    return rc;
+}
+
+RC
+MaaTManager::index_read(INDEX * index, uint64_t key, set<row_t *> * &rows, uint32_t limit)
+{
+    RC rc = RCOK;
+    rc = index_get_permission(RD, index, key, limit);
+    if (rc == RCOK) {
+        assert(_index_access_set.rbegin()->key == key);
+        rows = _index_access_set.rbegin()->rows;
+    }
+    return rc;
+}
+
+RC
+MaaTManager::index_insert(INDEX * index, uint64_t key)
+{
+    return index_get_permission(INS, index, key);
+}
+
+RC
+MaaTManager::index_delete(INDEX * index, uint64_t key)
+{
+    return index_get_permission(DEL, index, key);
+}
+
+RC
+MaaTManager::validate()
+{
+    init_time_table();
+    uint64_t txn_id = _txn->get_txn_id();
+    // the states and ranges read below must not change until the range of
+    // this transaction is set and the running ones are pushed out of it.
+    time_table->lock_validation();
+    uint64_t lower = time_table->get_lower(txn_id);
+    uint64_t upper = time_table->get_upper(txn_id);
+    set<uint64_t> before;
+    set<uint64_t> after;
+    for (const auto& access : _access_set) {
+        if (access.type == RD) {
+            // order after the version read
+            lower = std::max(lower, access.wts + 1);
+            // order before the writers of the row
+            for (auto id : access.uncommitted_writes) {
+                if (id == txn_id)
+                    continue;
+                TimeTable::State state = time_table->get_state(id);
+                if (state == TimeTable::VALIDATED || state == TimeTable::COMMITTED)
+                    upper = std::min(upper, time_table->get_lower(id));
+                else if (state == TimeTable::RUNNING)
+                    after.insert(id);
+            }
+        } else {
+            // order after the last read and write of the row
+            lower = std::max(lower, std::max(access.wts, access.rts) + 1);
+            // order after the readers of the row
+            for (auto id : access.uncommitted_reads) {
+                if (id == txn_id)
+                    continue;
+                TimeTable::State state = time_table->get_state(id);
+                if (state == TimeTable::VALIDATED || state == TimeTable::COMMITTED)
+                    lower = std::max(lower, time_table->get_upper(id));
+                else if (state == TimeTable::RUNNING)
+                    before.insert(id);
+            }
+            // validated writers go first; running writers go after.
+            for (auto id : access.uncommitted_writes) {
+                if (id == txn_id)
+                    continue;
+                TimeTable::State state = time_table->get_state(id);
+                if (state == TimeTable::VALIDATED || state == TimeTable::COMMITTED)
+                    lower = std::max(lower, time_table->get_upper(id));
+                else if (state == TimeTable::RUNNING)
+                    after.insert(id);
+            }
+        }
+    }
+    if (lower >= upper || !time_table->validate(txn_id, lower, upper)) {
+        time_table->unlock_validation();
+        return ABORT;
+    }
+    // push the running transactions out of the range of this one.
+    for (auto id : before)
+        time_table->reduce_upper(id, lower);
+    for (auto id : after)
+        time_table->raise_lower(id, upper);
+    time_table->unlock_validation();
+    _lower = lower;
+    _upper = upper;
+    return COMMIT;
+}
+
+/*
+ * commit insert / delete
+ */
+RC
+MaaTManager::commit_insdel()
+{
+    // TODO. Ignoring index consistency.
+    // handle inserts
+    for (auto ins : _inserts) {
+        row_t * row = ins.row;
+        set<INDEX *> indexes;
+        ins.table->get_indexes( &indexes );
+        for (auto idx : indexes) {
+            uint64_t key = row->get_index_key(idx);
+            idx->insert(key, row);
+        }
+    }
+    // handle deletes
+    for (auto row : _deletes) {
+        set<INDEX *> indexes;
+        row->get_table()->get_indexes( &indexes );
+        for (auto idx : indexes)
+            idx->remove( row );
+    }
+    return RCOK;
+}
+
+void
+MaaTManager::cleanup(RC rc)
+{
+    assert(rc == COMMIT || rc == ABORT);
+    uint64_t txn_id = _txn->get_txn_id();
+    if (rc == COMMIT) {
+        // the commit timestamp is the lower bound of the final range
+        uint64_t commit_ts = _lower;
+        if (_in_time_table) {
+            time_table->set_range(txn_id, commit_ts, commit_ts + 1);
+            time_table->set_state(txn_id, TimeTable::COMMITTED);
+        }
+        commit_insdel();
+        for (const auto& access : _access_set)
+            access.row->manager->commit(_txn, access.type, commit_ts, access.data);
+    } else {
+        if (_in_time_table)
+            time_table->set_state(txn_id, TimeTable::ABORTED);
+        for (const auto& access : _access_set)
+            access.row->manager->abort(_txn, access.type);
+    }
+    if (_in_time_table)
+        time_table->release(txn_id);
+    for (const auto& access : _access_set) {
+        assert(access.data);
+        delete [] access.data;
+    }
+    for (const auto& access : _remote_set) {
+        assert(access.data);
+        delete [] access.data;
+    }
+    if (rc == ABORT)
+        for (auto ins : _inserts)
+            delete ins.row;
+    _access_set.clear();
+    _remote_set.clear();
+    _inserts.clear();
+    _deletes.clear();
+    _index_access_set.clear();
+    _in_time_table = false;
+    _lower = 0;
+    _upper = UINT64_MAX;
+}
+
+// Distributed transactions
+// ========================
+void
+MaaTManager::process_remote_read_response(uint32_t node_id, access_t type, SundialResponse &response)
+{
+    assert(response.response_type() == SundialResponse::RESP_OK);
+    for (int i = 0; i < response.tuple_data_size(); i ++) {
+        AccessMaaT ac;
+        _remote_set.push_back(ac);
+        AccessMaaT * access = &(*_remote_set.rbegin());
+        assert(node_id != g_node_id);
+
+        access->home_node_id = node_id;
+        access->row = NULL;
+        access->key = response.tuple_data(i).key();
+        access->table_id = response.tuple_data(i).table_id();
+        access->type = type;
+        access->data_size = response.tuple_data(i).size();
+        access->data = new char [access->data_size];
+        copy_tuple_payload(access->data, response.tuple_data(i).data(), access->data_size);
+    }
+}
+
+void
+MaaTManager::process_remote_read_response(uint32_t node_id, SundialResponse &response)
+{
+    assert(response.response_type() == SundialResponse::RESP_OK);
+    for (int i = 0; i < response.tuple_data_size(); i ++) {
+        AccessMaaT ac;
+        _remote_set.push_back(ac);
+        AccessMaaT * access = &(*_remote_set.rbegin());
+        assert(node_id != g_node_id);
+
+        access->home_node_id = node_id;
+        access->row = NULL;
+        access->key = response.tuple_data(i).key();
+        access->table_id = response.tuple_data(i).table_id();
+        access->type = (access_t) response.tuple_data(i).access_type();
+        access->data_size = response.tuple_data(i).size();
+        access->data = new char [access->data_size];
+        copy_tuple_payload(access->data, response.tuple_data(i).data(), access->data_size);
+    }
+}
+
+void
+MaaTManager::build_prepare_req(uint32_t node_id, SundialRequest &request)
+{
+    for (auto access : _remote_set) {
+        if (access.home_node_id == node_id && access.type == WR) {
+            SundialRequest::TupleData * tuple = request.add_tuple_data();
+            uint64_t tuple_size = access.data_size;
+            tuple->set_key(access.key);
+            tuple->set_table_id( access.table_id );
+            tuple->set_size( tuple_size );
+            set_tuple_payload( tuple, access.data, tuple_size );
+        }
+    }
+}
+
+void
+MaaTManager::build_prepare_resp(SundialResponse &response)
+{
+    response.set_ts_lower(_lower);
+    response.set_ts_upper(_upper);
+}
+
+RC
+MaaTManager::process_prepare_resp(SundialResponse &response)
+{
+    _lower = std::max(_lower, (uint64_t) response.ts_lower());
+    _upper = std::min(_upper, (uint64_t) response.ts_upper());
+    return (_lower < _upper)? COMMIT : ABORT;
+}
+
+#endif
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "cc_manager.h"
+#include "rpc_client.h"
+
+// MaaT: optimistic concurrency control with dynamic timestamp allocation.
+// Each transaction keeps a commit timestamp range [lower, upper) in the
+// per-node TimeTable. Conflicting transactions are ordered by shrinking their
+// ranges instead of being aborted; a transaction aborts only when its range
+// becomes empty.
+// For distributed transactions, every participant validates locally and
+// returns its range in the prepare response. The coordinator intersects the
+// ranges and sends the commit timestamp with the decision.
+class MaaTManager : public CCManager
+{
+public:
+    MaaTManager(TxnManager * txn);
+    ~MaaTManager() {}
+
+    RC            get_row(row_t * row, access_t type, uint64_t key);
+    RC            get_row(row_t * row, access_t type, char * &data, uint64_t key);
+    char *        get_data( uint64_t key, uint32_t table_id);
+
+    RC            index_get_permission(access_t type, INDEX * index, uint64_t key, uint32_t limit=-1);
+    RC            index_read(INDEX * index, uint64_t key, set<row_t *> * &rows, uint32_t limit=-1);
+    RC            index_insert(INDEX * index, uint64_t key);
+    RC            index_delete(INDEX * index, uint64_t key);
+
+    void          process_remote_read_response(uint32_t node_id, access_t type, SundialResponse &response);
+    void          process_remote_read_response(uint32_t node_id, SundialResponse &response);
+    void          build_prepare_req(uint32_t node_id, SundialRequest &request);
+    // participant: return the local timestamp range to the coordinator.
+    void          build_prepare_resp(SundialResponse &response);
+    // coordinator: intersect the range of a participant with the local one.
+    RC            process_prepare_resp(SundialResponse &response);
+
+    uint64_t      get_commit_ts() { return _lower; }
+    void          set_commit_ts(uint64_t ts) { _lower = ts; _upper = ts + 1; }
+
+    RC            validate();
+    RC            commit_insdel();
+    void          cleanup(RC rc);
+
+#if EARLY_LOCK_RELEASE
+    void          retire() { assert(false); };
+#endif
+
+private:
+    class AccessMaaT : public Access {
+      public:
+        ~AccessMaaT() {}
+        AccessMaaT() { data = NULL; data_size = 0; wts = 0; rts = 0; }
+        char *        data;    // local copy of the tuple.
+        uint32_t      data_size;
+        uint64_t      wts;
+        uint64_t      rts;
+        set<uint64_t> uncommitted_reads;
+        set<uint64_t> uncommitted_writes;
+    };
+
+    void          init_time_table();
+
+    vector<AccessMaaT>        _access_set;
+    vector<AccessMaaT>        _remote_set;
+
+    vector<IndexAccess>       _index_access_set;
+
+    bool                      _in_time_table;
+    // commit timestamp range [lower, upper)
+    uint64_t                  _lower;
+    uint64_t                  _upper;
+};
@@ -0,0 +1,347 @@
+#include "mvcc_manager.h"
+#include "manager.h"
+#include "txn.h"
+#include "row_mvcc.h"
+#include "row.h"
+#include "index_base.h"
+#include "table.h"
+#include "index_hash.h"
+#include "query.h"
+#include "workload.h"
+#include "store_procedure.h"
+#include "txn_table.h"
+
+#if CC_ALG == IDEAL_MVCC
+
+MVCCManager::MVCCManager(TxnManager * txn)
+    : CCManager(txn)
+{
+    assert(g_ts_alloc == TS_CLOCK || g_ts_alloc == TS_CAS || g_ts_alloc == TS_HLC);
+    _timestamp = 0;
+    _commit_ts = 0;
+    _remote_ts = false;
+#if WORKLOAD == TPCC
+    _access_set.reserve(128);
+#endif
+}
+
+uint64_t
+MVCCManager::get_ts()
+{
+    // the snapshot is taken at the first access, so that a restarted
+    // transaction reads from a new snapshot.
+    if (_timestamp == 0) {
+        _timestamp = glob_manager->get_ts(GET_THD_ID);
+        // register the snapshot so that garbage collection keeps its versions.
+        glob_manager->add_ts(_timestamp);
+    }
+    return _timestamp;
+}
+
+void
+MVCCManager::set_ts(uint64_t ts)
+{
+    // every READ_REQ of the sub-txn carries the same snapshot, and so does a
+    // READ_REQ served again.
+    if (_remote_ts) {
+        assert(ts == _timestamp);
+        return;
+    }
+    _timestamp = ts;
+    _remote_ts = true;
+    glob_manager->add_remote_ts(ts);
+}
+
+RC
+MVCCManager::get_row(row_t * row, access_t type, uint64_t key)
+{
+    RC rc = RCOK;
+    assert(type == RD || type == WR);
+    uint64_t ts = get_ts();
+
+    AccessMVCC ac;
+    _access_set.push_back( ac );
+    AccessMVCC * access = &(*_access_set.rbegin());
+    access->key = key;
+    access->home_node_id = g_node_id;
+    access->table_id = row->get_table()->get_table_id();
+    access->type = type;
+    access->row = row;
+    access->data = new char [row->get_tuple_size()];
+    access->data_size = row->get_tuple_size();
+    if (type == RD) {
+        rc = row->manager->read(_txn, ts, access->data, access->wts);
+        if (rc == WAIT)
+            INC_INT_STATS(num_mvcc_read_waits, 1);
+        // a writer is committing a version visible at ts; wait for its
+        // decision. The writer never waits for a reader, so this cannot
+        // deadlock. Remote sub-txns run on rpc threads, which the decision
+        // may need; their reads are served again later instead
+        // (SundialRPCServerImpl::processContactRemote).
+        while (rc == WAIT && !_remote_ts && glob_manager->active) {
+            PAUSE10
+            rc = row->manager->read(_txn, ts, access->data, access->wts);
+        }
+        if (rc == WAIT && !_remote_ts)
+            rc = ABORT;
+    } else {
+        rc = row->manager->write(_txn, ts, access->data, access->wts);
+        if (rc == RCOK) _txn->set_read_only(false);
+    }
+    if (rc == ABORT || rc == WAIT) {
+        delete [] access->data;
+        _access_set.pop_back();
+    }
+    return rc;
+}
+
+RC
+MVCCManager::get_row(row_t * row, access_t type, char * &data, uint64_t key)
+{
+    RC rc = get_row(row, type, key);
+    if (rc == RCOK) {
+        data = _access_set.rbegin()->data;
+        assert(data);
+    }
+    return rc;
+}
+
+char *
+MVCCManager::get_data(uint64_t key, uint32_t table_id)
+{
+    for (auto & it : _access_set)
+        if (it.key == key && it.table_id == table_id)
+            return it.data;
+
+    for (auto & it : _remote_set)
+        if (it.key == key && it.table_id == table_id)
+            return it.data;
+
+    // data not found
+    assert(false);
+    return nullptr;
+}
+
+RC
+MVCCManager::index_get_permission(access_t type, INDEX * index, uint64_t key, uint32_t limit)
+{
+    RC rc = RCOK;
+    assert(type == RD || type == INS || type == DEL);
+    if (type == INS || type == DEL) _txn->set_read_only(false);
+
+    // if already accessed
+    for (uint32_t i = 0; i < _index_access_set.size(); i++) {
+        IndexAccess * ac = &_index_access_set[i];
+        if ( ac->index == index && ac->key == key )  {
+            if (ac->type == type) {
+                ac->rows = index->read(key);
+            } else {
+                assert( (ac->type == RD)
+                            && (type == INS || type == DEL) );
+                ac->type = type;
+            }
+            return rc;
+        }
+    }
+
+    // Index is not versioned (see CCManager::commit_insdel). The manager
+    // latch only protects the atomicity of read / insert / delete index.
+    ROW_MAN * manager = index->index_get_manager(key);
+    IndexAccess access;
+    if (type == RD)
+        access.rows = index->read(key);
+    manager->unlatch();
+
+    access.key = key;
+    access.index = index;
+    access.type = type;
+    access.manager = manager;
+    _index_access_set.push_back(access);
+    return rc;
+}
+
+RC
+MVCCManager::index_read(INDEX * index, uint64_t key, set<row_t *> * &rows, uint32_t limit)
+{
+    RC rc = RCOK;
+    rc = index_get_permission(RD, index, key, limit);
+    if (rc == RCOK) {
+        assert(_index_access_set.rbegin()->key == key);
+        rows = _index_access_set.rbegin()->rows;
+    }
+    return rc;
+}
+
+RC
+MVCCManager::index_insert(INDEX * index, uint64_t key)
+{
+    return index_get_permission(INS, index, key);
+}
+
+RC
+MVCCManager::index_delete(INDEX * index, uint64_t key)
+{
+    return index_get_permission(DEL, index, key);
+}
+
+RC
+MVCCManager::validate()
+{
+    // read-only transactions commit on their snapshot.
+    if (_commit_ts == 0 && _txn->is_read_only() && _txn->is_txn_read_only())
+        return COMMIT;
+    // 1. pick the commit timestamp. Participants use the coordinator's.
+    if (_commit_ts == 0)
+        _commit_ts = glob_manager->get_ts(GET_THD_ID);
+    // mark the write set. A reader whose snapshot is at or above the commit
+    // timestamp (e.g. of a node whose clock is ahead) either read the row
+    // before, and the writer aborts, or sees the mark and aborts itself.
+    for (const auto& access : _access_set) {
+        if (access.type == WR &&
+            !access.row->manager->set_pending(_txn, _commit_ts)) {
+            INC_INT_STATS(num_mvcc_rts_aborts, 1);
+            return ABORT;
+        }
+    }
+#if ISOLATION_LEVEL == SERIALIZABLE
+    // 2. the read set must not be overwritten between the snapshot and the
+    // commit timestamp.
+    for (const auto& access : _access_set) {
+        if (access.type == RD &&
+            !access.row->manager->validate_read(_txn, access.wts, _commit_ts))
+            return ABORT;
+    }
+#endif
+    return COMMIT;
+}
+
+/*
+ * commit insert / delete
+ */
+RC
+MVCCManager::commit_insdel()
+{
+    // TODO. Ignoring index consistency.
+    // handle inserts
+    for (auto ins : _inserts) {
+        row_t * row = ins.row;
+        set<INDEX *> indexes;
+        ins.table->get_indexes( &indexes );
+        for (auto idx : indexes) {
+            uint64_t key = row->get_index_key(idx);
+            idx->insert(key, row);
+        }
+    }
+    // handle deletes
+    for (auto row : _deletes) {
+        set<INDEX *> indexes;
+        row->get_table()->get_indexes( &indexes );
+        for (auto idx : indexes)
+            idx->remove( row );
+    }
+    return RCOK;
+}
+
+void
+MVCCManager::cleanup(RC rc)
+{
+    assert(rc == COMMIT || rc == ABORT);
+    if (rc == COMMIT) {
+        commit_insdel();
+        for (const auto& access : _access_set) {
+            if (access.type == WR) {
+                assert(_commit_ts != 0);
+                access.row->manager->commit(_txn, _commit_ts, access.data);
+            }
+        }
+    } else { // rc == ABORT
+        for (const auto& access : _access_set)
+            if (access.type == WR)
+                access.row->manager->release(_txn);
+    }
+    for (const auto& access : _access_set) {
+        assert(access.data);
+        delete [] access.data;
+    }
+    for (const auto& access : _remote_set) {
+        assert(access.data);
+        delete [] access.data;
+    }
+    if (rc == ABORT)
+        for (auto ins : _inserts)
+            delete ins.row;
+    _access_set.clear();
+    _remote_set.clear();
+    _inserts.clear();
+    _deletes.clear();
+    _index_access_set.clear();
+    if (_remote_ts) {
+        glob_manager->remove_remote_ts(_timestamp);
+        _remote_ts = false;
+    }
+    _timestamp = 0;
+    _commit_ts = 0;
+}
+
+// Distributed transactions
+// ========================
+void
+MVCCManager::process_remote_read_response(uint32_t node_id, access_t type, SundialResponse &response)
+{
+    assert(response.response_type() == SundialResponse::RESP_OK);
+    for (int i = 0; i < response.tuple_data_size(); i ++) {
+        AccessMVCC ac;
+        _remote_set.push_back(ac);
+        AccessMVCC * access = &(*_remote_set.rbegin());
+        assert(node_id != g_node_id);
+
+        access->home_node_id = node_id;
+        access->row = NULL;
+        access->key = response.tuple_data(i).key();
+        access->table_id = response.tuple_data(i).table_id();
+        access->type = type;
+        access->data_size = response.tuple_data(i).size();
+        access->data = new char [access->data_size];
+        copy_tuple_payload(access->data, response.tuple_data(i).data(), access->data_size);
+    }
+}
+
+void
+MVCCManager::process_remote_read_response(uint32_t node_id, SundialResponse &response)
+{
+    assert(response.response_type() == SundialResponse::RESP_OK);
+    for (int i = 0; i < response.tuple_data_size(); i ++) {
+        AccessMVCC ac;
+        _remote_set.push_back(ac);
+        AccessMVCC * access = &(*_remote_set.rbegin());
+        assert(node_id != g_node_id);
+
+        access->home_node_id = node_id;
+        access->row = NULL;
+        access->key = response.tuple_data(i).key();
+        access->table_id = response.tuple_data(i).table_id();
+        access->type = (access_t) response.tuple_data(i).access_type();
+        access->data_size = response.tuple_data(i).size();
+        access->data = new char [access->data_size];
+        copy_tuple_payload(access->data, response.tuple_data(i).data(), access->data_size);
+    }
+}
+
+void
+MVCCManager::build_prepare_req(uint32_t node_id, SundialRequest &request)
+{
+    // commit timestamp is 0 if the entire transaction is read-only.
+    request.set_ts(_commit_ts);
+    for (auto access : _remote_set) {
+        if (access.home_node_id == node_id && access.type == WR) {
+            SundialRequest::TupleData * tuple = request.add_tuple_data();
+            uint64_t tuple_size = access.data_size;
+            tuple->set_key(access.key);
+            tuple->set_table_id( access.table_id );
+            tuple->set_size( tuple_size );
+            set_tuple_payload( tuple, access.data, tuple_size );
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "cc_manager.h"
+#include "rpc_client.h"
+
+// Multi-version concurrency control.
+// Every transaction reads from the snapshot at its start timestamp. Writes
+// take a NO_WAIT write lock and are installed as new versions at the commit
+// timestamp. With ISOLATION_LEVEL == SERIALIZABLE, reads of read-write
+// transactions are validated at the commit timestamp; read-only transactions
+// always commit on their snapshot without validation. This holds across nodes
+// since a writer aborts rather than commit below a snapshot that read one of
+// its rows (see Row_MVCC::set_pending).
+class MVCCManager : public CCManager
+{
+public:
+    MVCCManager(TxnManager * txn);
+    ~MVCCManager() {}
+
+    RC            get_row(row_t * row, access_t type, uint64_t key);
+    RC            get_row(row_t * row, access_t type, char * &data, uint64_t key);
+    char *        get_data( uint64_t key, uint32_t table_id);
+
+    RC            index_get_permission(access_t type, INDEX * index, uint64_t key, uint32_t limit=-1);
+    RC            index_read(INDEX * index, uint64_t key, set<row_t *> * &rows, uint32_t limit=-1);
+    RC            index_insert(INDEX * index, uint64_t key);
+    RC            index_delete(INDEX * index, uint64_t key);
+
+    // snapshot timestamp. Remote sub-transactions use the coordinator's,
+    // which is registered for garbage collection until cleanup.
+    uint64_t      get_ts();
+    void          set_ts(uint64_t ts);
+    // commit timestamp. Assigned by the coordinator during validation.
+    void          set_commit_ts(uint64_t ts) { _commit_ts = ts; }
+
+    void          process_remote_read_response(uint32_t node_id, access_t type, SundialResponse &response);
+    void          process_remote_read_response(uint32_t node_id, SundialResponse &response);
+    void          build_prepare_req(uint32_t node_id, SundialRequest &request);
+
+    RC            validate();
+    RC            commit_insdel();
+    void          cleanup(RC rc);
+
+#if EARLY_LOCK_RELEASE
+    void          retire() { assert(false); };
+#endif
+
+private:
+    class AccessMVCC : public Access {
+      public:
+        ~AccessMVCC() {}
+        AccessMVCC() { data = NULL; data_size = 0; wts = 0; }
+        char *        data;    // local copy of the version read.
+        uint32_t      data_size;
+        uint64_t      wts;     // wts of the version read.
+    };
+
+    vector<AccessMVCC>        _access_set;
+    vector<AccessMVCC>        _remote_set;
+
+    vector<IndexAccess>       _index_access_set;
+
+    uint64_t                  _commit_ts;
+    bool                      _remote_ts;
+};
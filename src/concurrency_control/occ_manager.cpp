@@ -340,7 +340,7 @@ OccManager::process_remote_read_response(uint32_t node_id, access_t type, Sundia
             static_cast<access_t>(response.tuple_data(i).access_type());
         access->version = response.tuple_data(i).version();
         access->index_id = response.tuple_data(i).index_id();
-        memcpy(access->data, response.tuple_data(i).data().c_str(), access->data_size);
+        copy_tuple_payload(access->data, response.tuple_data(i).data(), access->data_size);
     }
 }
 
@@ -364,7 +364,7 @@ OccManager::process_remote_read_response(uint32_t node_id, SundialResponse &resp
             static_cast<access_t>(response.tuple_data(i).access_type());
         access->version = response.tuple_data(i).version();
         access->index_id = response.tuple_data(i).index_id();
-        memcpy(access->data, response.tuple_data(i).data().c_str(), access->data_size);
+        copy_tuple_payload(access->data, response.tuple_data(i).data(), access->data_size);
     }
 }
 
@@ -378,7 +378,7 @@ OccManager::build_prepare_req(uint32_t node_id, SundialRequest &request)
             tuple->set_key(access.key);
             tuple->set_table_id( access.table_id );
             tuple->set_size( tuple_size );
-            tuple->set_data( access.data, tuple_size );
+            set_tuple_payload( tuple, access.data, tuple_size );
             tuple->set_access_type(access.type);
             tuple->set_version(access.version);
             tuple->set_index_id( access.index_id );
@@ -4,6 +4,7 @@
 #include "manager.h"
 #include "lock_manager.h"
 #include "f1_manager.h"
+#include "hot_key_tracker.h"
 
 #if CC_ALG == WAIT_DIE || CC_ALG == NO_WAIT
 
@@ -169,6 +170,10 @@ Row_lock::lock_get(LockType type, TxnManager * txn, bool need_latch)
     }*/
 #endif
     if (need_latch) unlatch();
+#if HOT_KEY_TRACKING
+    if (rc != RCOK && _row)
+        hot_key_tracker->record(_row->get_table_id(), _row->get_primary_key());
+#endif
     return rc;
 }
 
@@ -0,0 +1,116 @@
+#include "row.h"
+#include "txn.h"
+#include "row_maat.h"
+#include "manager.h"
+#include "maat_manager.h"
+#include "time_table.h"
+
+#if CC_ALG == MAAT
+
+Row_maat::Row_maat()
+{
+    _row = NULL;
+    _wts = 0;
+    _rts = 0;
+    pthread_mutex_init(&_latch, NULL);
+}
+
+Row_maat::Row_maat(row_t * row)
+    : Row_maat()
+{
+    _row = row;
+}
+
+void
+Row_maat::init(row_t * row)
+{
+    _row = row;
+    _wts = 0;
+    _rts = 0;
+}
+
+void
+Row_maat::latch()
+{
+    pthread_mutex_lock( &_latch );
+}
+
+void
+Row_maat::unlatch()
+{
+    pthread_mutex_unlock( &_latch );
+}
+
+RC
+Row_maat::read(TxnManager * txn, char * data, uint64_t &wts,
+               std::set<uint64_t> &uncommitted_writes)
+{
+    latch();
+    memcpy(data, _row->get_data(), _row->get_tuple_size());
+    wts = _wts;
+    uncommitted_writes = _uncommitted_writes;
+    _uncommitted_reads.insert(txn->get_txn_id());
+    unlatch();
+    return RCOK;
+}
+
+RC
+Row_maat::prewrite(TxnManager * txn, char * data, uint64_t &wts, uint64_t &rts,
+                   std::set<uint64_t> &uncommitted_reads,
+                   std::set<uint64_t> &uncommitted_writes)
+{
+    latch();
+    memcpy(data, _row->get_data(), _row->get_tuple_size());
+    wts = _wts;
+    rts = _rts;
+    uncommitted_reads = _uncommitted_reads;
+    uncommitted_writes = _uncommitted_writes;
+    _uncommitted_writes.insert(txn->get_txn_id());
+    unlatch();
+    return RCOK;
+}
+
+void
+Row_maat::commit(TxnManager * txn, access_t type, uint64_t ts, char * data)
+{
+    uint64_t txn_id = txn->get_txn_id();
+    latch();
+    if (type == RD) {
+        if (ts > _rts)
+            _rts = ts;
+        _uncommitted_reads.erase(txn_id);
+        // running writers of the row must be ordered after this read.
+        for (auto id : _uncommitted_writes)
+            if (id != txn_id)
+                time_table->raise_lower(id, ts + 1);
+    } else {
+        assert(type == WR);
+        // a newer version is already installed (Thomas write rule).
+        if (ts > _wts) {
+            _row->copy(data);
+            _wts = ts;
+        }
+        _uncommitted_writes.erase(txn_id);
+        // running readers have read the old version and must be ordered
+        // before this write; running writers are ordered after it.
+        for (auto id : _uncommitted_reads)
+            if (id != txn_id)
+                time_table->reduce_upper(id, ts);
+        for (auto id : _uncommitted_writes)
+            time_table->raise_lower(id, ts + 1);
+    }
+    unlatch();
+}
+
+void
+Row_maat::abort(TxnManager * txn, access_t type)
+{
+    latch();
+    if (type == RD)
+        _uncommitted_reads.erase(txn->get_txn_id());
+    else
+        _uncommitted_writes.erase(txn->get_txn_id());
+    unlatch();
+}
+
+#endif
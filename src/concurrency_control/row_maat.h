@@ -0,0 +1,39 @@
+#pragma once
+
+#include <set>
+#include "global.h"
+
+class TxnManager;
+class CCManager;
+class MaaTManager;
+class row_t;
+
+class Row_maat {
+public:
+    Row_maat();
+    Row_maat(row_t * row);
+    virtual         ~Row_maat() {}
+    virtual void    init(row_t * row);
+
+    // copy the committed data and the timestamps of the row. Transactions
+    // that have uncommitted accesses to the row are returned so that the
+    // caller can order itself against them during validation.
+    RC              read(TxnManager * txn, char * data, uint64_t &wts,
+                         std::set<uint64_t> &uncommitted_writes);
+    RC              prewrite(TxnManager * txn, char * data, uint64_t &wts, uint64_t &rts,
+                             std::set<uint64_t> &uncommitted_reads,
+                             std::set<uint64_t> &uncommitted_writes);
+    void            commit(TxnManager * txn, access_t type, uint64_t ts, char * data);
+    void            abort(TxnManager * txn, access_t type);
+
+    void            latch();
+    void            unlatch();
+
+private:
+    row_t *         _row;
+    pthread_mutex_t _latch;
+    uint64_t        _wts;
+    uint64_t        _rts;
+    std::set<uint64_t> _uncommitted_reads;
+    std::set<uint64_t> _uncommitted_writes;
+};
@@ -0,0 +1,261 @@
+#include "row.h"
+#include "txn.h"
+#include "row_mvcc.h"
+#include "manager.h"
+#include "mvcc_manager.h"
+
+#if CC_ALG == IDEAL_MVCC
+
+std::queue<Row_MVCC *> Row_MVCC::_gc_queue;
+pthread_mutex_t Row_MVCC::_gc_latch = PTHREAD_MUTEX_INITIALIZER;
+
+Row_MVCC::Row_MVCC()
+{
+    _row = NULL;
+    _latest_wts = 0;
+    _max_rts = 0;
+    _history = NULL;
+    _lock_owner = NULL;
+    _pending_ts = 0;
+    _gc_queued = false;
+    pthread_mutex_init(&_latch, NULL);
+}
+
+Row_MVCC::Row_MVCC(row_t * row)
+    : Row_MVCC()
+{
+    _row = row;
+}
+
+Row_MVCC::~Row_MVCC()
+{
+    while (_history) {
+        Version * next = _history->next;
+        delete [] _history->data;
+        delete _history;
+        _history = next;
+    }
+}
+
+void
+Row_MVCC::init(row_t * row)
+{
+    _row = row;
+    _latest_wts = 0;
+    _max_rts = 0;
+}
+
+void
+Row_MVCC::latch()
+{
+    pthread_mutex_lock( &_latch );
+}
+
+void
+Row_MVCC::unlatch()
+{
+    pthread_mutex_unlock( &_latch );
+}
+
+RC
+Row_MVCC::read(TxnManager * txn, uint64_t ts, char * data, uint64_t &wts)
+{
+    latch();
+    // A writer in validation will commit a version visible at ts. The reader
+    // waits for the decision of the writer (see MVCCManager::get_row); it
+    // does not abort, so read-only transactions always commit.
+    // A writer without a commit timestamp yet will commit above ts since the
+    // read below raises _max_rts.
+    if (_lock_owner != NULL && _lock_owner != txn && _pending_ts != 0
+        && _pending_ts <= ts) {
+        unlatch();
+        return WAIT;
+    }
+    if (_latest_wts <= ts) {
+        memcpy(data, _row->get_data(), _row->get_tuple_size());
+        wts = _latest_wts;
+        if (ts > _max_rts)
+            _max_rts = ts;
+        unlatch();
+        return RCOK;
+    }
+    for (Version * v = _history; v != NULL; v = v->next) {
+        if (v->wts <= ts) {
+            memcpy(data, v->data, _row->get_tuple_size());
+            wts = v->wts;
+            unlatch();
+            return RCOK;
+        }
+    }
+    // garbage collection keeps the versions of registered snapshots
+    // (Manager::get_min_ts).
+    unlatch();
+    assert(false);
+    return ABORT;
+}
+
+RC
+Row_MVCC::write(TxnManager * txn, uint64_t ts, char * data, uint64_t &wts)
+{
+    latch();
+    if (_lock_owner != NULL && _lock_owner != txn) {
+        unlatch();
+        return ABORT;
+    }
+    // a newer version is committed after the snapshot was taken.
+    if (_latest_wts > ts) {
+        unlatch();
+        return ABORT;
+    }
+    _lock_owner = txn;
+    memcpy(data, _row->get_data(), _row->get_tuple_size());
+    wts = _latest_wts;
+    unlatch();
+    return RCOK;
+}
+
+bool
+Row_MVCC::set_pending(TxnManager * txn, uint64_t ts)
+{
+    latch();
+    assert(_lock_owner == txn);
+    // a snapshot at or after ts has read the latest version. The new version
+    // would be visible to it but missing from what it read.
+    if (ts <= _max_rts) {
+        unlatch();
+        return false;
+    }
+    _pending_ts = ts;
+    unlatch();
+    return true;
+}
+
+bool
+Row_MVCC::validate_read(TxnManager * txn, uint64_t read_wts, uint64_t commit_ts)
+{
+    bool valid = false;
+    latch();
+    if (_lock_owner != NULL && _lock_owner != txn && _pending_ts != 0
+        && _pending_ts <= commit_ts) {
+        // another writer is going to commit before commit_ts.
+        unlatch();
+        return false;
+    }
+    if (_latest_wts <= commit_ts) {
+        valid = (_latest_wts == read_wts);
+        if (valid && commit_ts > _max_rts)
+            _max_rts = commit_ts;
+    } else {
+        for (Version * v = _history; v != NULL; v = v->next) {
+            if (v->wts <= commit_ts) {
+                valid = (v->wts == read_wts);
+                break;
+            }
+        }
+    }
+    unlatch();
+    return valid;
+}
+
+void
+Row_MVCC::commit(TxnManager * txn, uint64_t commit_ts, char * data)
+{
+    latch();
+    assert(_lock_owner == txn);
+    assert(commit_ts > _latest_wts);
+    // move the current image to the version chain.
+    Version * v = new Version;
+    v->wts = _latest_wts;
+    v->data = new char [_row->get_tuple_size()];
+    memcpy(v->data, _row->get_data(), _row->get_tuple_size());
+    v->next = _history;
+    _history = v;
+
+    _row->copy(data);
+    _latest_wts = commit_ts;
+    _pending_ts = 0;
+    _lock_owner = NULL;
+    bool need_gc = !_gc_queued;
+    _gc_queued = true;
+    unlatch();
+
+    if (need_gc) {
+        pthread_mutex_lock( &_gc_latch );
+        _gc_queue.push(this);
+        pthread_mutex_unlock( &_gc_latch );
+    }
+}
+
+void
+Row_MVCC::release(TxnManager * txn)
+{
+    latch();
+    if (_lock_owner == txn) {
+        _lock_owner = NULL;
+        _pending_ts = 0;
+    }
+    unlatch();
+}
+
+bool
+Row_MVCC::gc(uint64_t min_ts, uint32_t &num_freed)
+{
+    Version * garbage = NULL;
+    latch();
+    if (_latest_wts <= min_ts) {
+        garbage = _history;
+        _history = NULL;
+    } else {
+        // keep the newest version visible at min_ts.
+        for (Version * v = _history; v != NULL; v = v->next) {
+            if (v->wts <= min_ts) {
+                garbage = v->next;
+                v->next = NULL;
+                break;
+            }
+        }
+    }
+    bool remain = (_history != NULL);
+    if (!remain)
+        _gc_queued = false;
+    unlatch();
+
+    // free outside the latch
+    while (garbage) {
+        Version * next = garbage->next;
+        delete [] garbage->data;
+        delete garbage;
+        garbage = next;
+        num_freed ++;
+    }
+    return remain;
+}
+
+void
+Row_MVCC::garbage_collect()
+{
+    while (glob_manager->active) {
+        uint64_t min_ts = glob_manager->get_min_ts();
+        uint32_t num_freed = 0;
+        // only visit rows queued before this pass; rows still holding versions
+        // are queued again for the next pass.
+        pthread_mutex_lock( &_gc_latch );
+        size_t num_rows = _gc_queue.size();
+        pthread_mutex_unlock( &_gc_latch );
+        for (size_t i = 0; i < num_rows; i++) {
+            pthread_mutex_lock( &_gc_latch );
+            Row_MVCC * row = _gc_queue.front();
+            _gc_queue.pop();
+            pthread_mutex_unlock( &_gc_latch );
+            if (row->gc(min_ts, num_freed)) {
+                pthread_mutex_lock( &_gc_latch );
+                _gc_queue.push(row);
+                pthread_mutex_unlock( &_gc_latch );
+            }
+        }
+        INC_INT_STATS(num_mvcc_gc_versions, num_freed);
+        usleep(MVCC_GC_INTVL);
+    }
+}
+
+#endif
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <queue>
+#include "global.h"
+
+class TxnManager;
+class CCManager;
+class MVCCManager;
+class row_t;
+
+// Multi-version row manager.
+// The latest committed image lives in row_t::data; older images are kept in a
+// version chain (newest first) until no active snapshot can see them.
+// The row also keeps the largest timestamp its latest image was read at, and
+// a writer may only install a new version above it. A snapshot that read the
+// row therefore never misses a version committed later.
+class Row_MVCC {
+public:
+    Row_MVCC();
+    Row_MVCC(row_t * row);
+    virtual         ~Row_MVCC();
+    virtual void    init(row_t * row);
+
+    // snapshot read. copy the version visible at ts into data.
+    // return WAIT if a writer is committing a version visible at ts.
+    RC              read(TxnManager * txn, uint64_t ts, char * data, uint64_t &wts);
+    // take the write lock (NO_WAIT) and copy the latest version into data.
+    // abort if the latest version is not visible at ts (first-updater-wins).
+    RC              write(TxnManager * txn, uint64_t ts, char * data, uint64_t &wts);
+    // during validation, announce the commit timestamp of the lock owner.
+    // return false if the latest version was read at or after ts.
+    bool            set_pending(TxnManager * txn, uint64_t ts);
+    // check that no version is created between read_wts and commit_ts.
+    // the read then holds until commit_ts.
+    bool            validate_read(TxnManager * txn, uint64_t read_wts, uint64_t commit_ts);
+    // install data as a new version and release the write lock.
+    void            commit(TxnManager * txn, uint64_t commit_ts, char * data);
+    void            release(TxnManager * txn);
+
+    void            latch();
+    void            unlatch();
+
+    // background garbage collection
+    // remove versions that are invisible to every snapshot after min_ts.
+    // return value: whether old versions remain in the chain.
+    bool            gc(uint64_t min_ts, uint32_t &num_freed);
+    static void     garbage_collect();
+private:
+    struct Version {
+        uint64_t    wts;
+        char *      data;
+        Version *   next;
+    };
+
+    row_t *         _row;
+    pthread_mutex_t _latch;
+
+    uint64_t        _latest_wts; // wts of the image in row_t::data
+    uint64_t        _max_rts;    // max ts the image in row_t::data is read at
+    Version *       _history;
+
+    TxnManager *    _lock_owner;
+    uint64_t        _pending_ts;
+
+    bool            _gc_queued;
+    static std::queue<Row_MVCC *> _gc_queue;
+    static pthread_mutex_t _gc_latch;
+};
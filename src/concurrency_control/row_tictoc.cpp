@@ -6,6 +6,7 @@
 #include "manager.h"
 #include "stdlib.h"
 #include "table.h"
+#include "hot_key_tracker.h"
 
 #if CC_ALG==TICTOC
 
@@ -108,6 +109,10 @@ Row_tictoc::write(TxnManager * txn, uint64_t &wts, uint64_t &rts, bool latch)
     }
     if (latch)
         pthread_mutex_unlock( _latch );
+#if HOT_KEY_TRACKING
+    if (rc != RCOK && _row)
+        hot_key_tracker->record(_row->get_table_id(), _row->get_primary_key());
+#endif
     return rc;
 }
 
@@ -563,6 +568,10 @@ Row_tictoc::try_lock(TxnManager * txn)
     }
 #endif
     pthread_mutex_unlock( _latch );
+#if HOT_KEY_TRACKING
+    if (rc != RCOK && _row)
+        hot_key_tracker->record(_row->get_table_id(), _row->get_primary_key());
+#endif
     return rc;
 }
 
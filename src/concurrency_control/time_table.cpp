@@ -0,0 +1,192 @@
+#include "time_table.h"
+#include "manager.h"
+
+#if CC_ALG == MAAT
+
+TimeTable::TimeTable()
+{
+    _table_size = g_num_nodes * g_num_worker_threads;
+    _buckets = new Bucket * [_table_size];
+    for (uint32_t i = 0; i < _table_size; i++) {
+        _buckets[i] = (Bucket *) _mm_malloc(sizeof(Bucket), 64);
+        _buckets[i]->first = NULL;
+        _buckets[i]->latch = false;
+    }
+    pthread_mutex_init( &_validation_latch, NULL );
+}
+
+TimeTable::Bucket *
+TimeTable::get_bucket(uint64_t txn_id)
+{
+    return _buckets[txn_id % _table_size];
+}
+
+void
+TimeTable::latch(Bucket * bucket)
+{
+    while ( !ATOM_CAS(bucket->latch, false, true) )
+        PAUSE
+    COMPILER_BARRIER
+}
+
+void
+TimeTable::unlatch(Bucket * bucket)
+{
+    COMPILER_BARRIER
+    bucket->latch = false;
+}
+
+TimeTable::Entry *
+TimeTable::find_entry(Bucket * bucket, uint64_t txn_id)
+{
+    Entry * entry = bucket->first;
+    while (entry && entry->txn_id != txn_id)
+        entry = entry->next;
+    return entry;
+}
+
+void
+TimeTable::init(uint64_t txn_id)
+{
+    Bucket * bucket = get_bucket(txn_id);
+    Entry * entry = new Entry;
+    entry->txn_id = txn_id;
+    entry->lower = 0;
+    entry->upper = UINT64_MAX;
+    entry->state = RUNNING;
+    latch(bucket);
+    assert(find_entry(bucket, txn_id) == NULL);
+    entry->next = bucket->first;
+    bucket->first = entry;
+    unlatch(bucket);
+}
+
+void
+TimeTable::release(uint64_t txn_id)
+{
+    Bucket * bucket = get_bucket(txn_id);
+    Entry * rm_entry = NULL;
+    latch(bucket);
+    Entry * entry = bucket->first;
+    if (entry && entry->txn_id == txn_id) {
+        rm_entry = entry;
+        bucket->first = entry->next;
+    } else {
+        while (entry && entry->next && entry->next->txn_id != txn_id)
+            entry = entry->next;
+        if (entry && entry->next) {
+            rm_entry = entry->next;
+            entry->next = rm_entry->next;
+        }
+    }
+    unlatch(bucket);
+    if (rm_entry)
+        delete rm_entry;
+}
+
+TimeTable::State
+TimeTable::get_state(uint64_t txn_id)
+{
+    Bucket * bucket = get_bucket(txn_id);
+    latch(bucket);
+    Entry * entry = find_entry(bucket, txn_id);
+    State state = entry ? entry->state : ABORTED;
+    unlatch(bucket);
+    return state;
+}
+
+uint64_t
+TimeTable::get_lower(uint64_t txn_id)
+{
+    Bucket * bucket = get_bucket(txn_id);
+    latch(bucket);
+    Entry * entry = find_entry(bucket, txn_id);
+    uint64_t lower = entry ? entry->lower : 0;
+    unlatch(bucket);
+    return lower;
+}
+
+uint64_t
+TimeTable::get_upper(uint64_t txn_id)
+{
+    Bucket * bucket = get_bucket(txn_id);
+    latch(bucket);
+    Entry * entry = find_entry(bucket, txn_id);
+    uint64_t upper = entry ? entry->upper : UINT64_MAX;
+    unlatch(bucket);
+    return upper;
+}
+
+void
+TimeTable::set_state(uint64_t txn_id, State state)
+{
+    Bucket * bucket = get_bucket(txn_id);
+    latch(bucket);
+    Entry * entry = find_entry(bucket, txn_id);
+    if (entry)
+        entry->state = state;
+    unlatch(bucket);
+}
+
+void
+TimeTable::set_range(uint64_t txn_id, uint64_t lower, uint64_t upper)
+{
+    Bucket * bucket = get_bucket(txn_id);
+    latch(bucket);
+    Entry * entry = find_entry(bucket, txn_id);
+    if (entry) {
+        entry->lower = lower;
+        entry->upper = upper;
+    }
+    unlatch(bucket);
+}
+
+bool
+TimeTable::validate(uint64_t txn_id, uint64_t &lower, uint64_t &upper)
+{
+    Bucket * bucket = get_bucket(txn_id);
+    latch(bucket);
+    Entry * entry = find_entry(bucket, txn_id);
+    assert(entry && entry->state == RUNNING);
+    // the range may have been shrunk by others since it was read.
+    if (entry->lower > lower)
+        lower = entry->lower;
+    if (entry->upper < upper)
+        upper = entry->upper;
+    bool valid = (lower < upper);
+    if (valid) {
+        if (upper == UINT64_MAX)
+            upper = lower + MAAT_RANGE_SIZE;
+        entry->lower = lower;
+        entry->upper = upper;
+        entry->state = VALIDATED;
+    } else
+        entry->state = ABORTED;
+    unlatch(bucket);
+    return valid;
+}
+
+void
+TimeTable::raise_lower(uint64_t txn_id, uint64_t ts)
+{
+    Bucket * bucket = get_bucket(txn_id);
+    latch(bucket);
+    Entry * entry = find_entry(bucket, txn_id);
+    // only running transactions can be moved
+    if (entry && entry->state == RUNNING && entry->lower < ts)
+        entry->lower = ts;
+    unlatch(bucket);
+}
+
+void
+TimeTable::reduce_upper(uint64_t txn_id, uint64_t ts)
+{
+    Bucket * bucket = get_bucket(txn_id);
+    latch(bucket);
+    Entry * entry = find_entry(bucket, txn_id);
+    if (entry && entry->state == RUNNING && entry->upper > ts)
+        entry->upper = ts;
+    unlatch(bucket);
+}
+
+#endif
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "global.h"
+
+// For MaaT
+// The per-node TimeTable keeps the commit timestamp range [lower, upper) of
+// every active transaction that has accessed data on this node. Transactions
+// adjust each other's ranges during validation and commit.
+class TimeTable
+{
+public:
+    enum State {
+        RUNNING,
+        VALIDATED,
+        COMMITTED,
+        ABORTED
+    };
+
+    TimeTable();
+    void        init(uint64_t txn_id);
+    void        release(uint64_t txn_id);
+
+    // a released or unknown transaction is reported as ABORTED
+    State       get_state(uint64_t txn_id);
+    uint64_t    get_lower(uint64_t txn_id);
+    uint64_t    get_upper(uint64_t txn_id);
+    void        set_state(uint64_t txn_id, State state);
+    void        set_range(uint64_t txn_id, uint64_t lower, uint64_t upper);
+    // intersect [lower, upper) with the range in the table and mark the
+    // transaction VALIDATED if the result is not empty. An unbounded range is
+    // capped to MAAT_RANGE_SIZE so that later transactions can be ordered
+    // after it. Return value: whether the range is not empty.
+    bool        validate(uint64_t txn_id, uint64_t &lower, uint64_t &upper);
+    // lower = max(lower, ts); upper = min(upper, ts)
+    void        raise_lower(uint64_t txn_id, uint64_t ts);
+    void        reduce_upper(uint64_t txn_id, uint64_t ts);
+
+    // Validations are serialized. A validating transaction reads the state
+    // and range of the others, sets its own range and pushes the running
+    // ones out of it; another validation in between could leave both
+    // transactions with overlapping ranges.
+    void        lock_validation()   { pthread_mutex_lock( &_validation_latch ); }
+    void        unlock_validation() { pthread_mutex_unlock( &_validation_latch ); }
+
+private:
+    struct Entry {
+        uint64_t    txn_id;
+        uint64_t    lower;
+        uint64_t    upper;
+        State       state;
+        Entry *     next;
+    };
+    struct Bucket {
+        Entry *     first;
+        volatile bool latch;
+    };
+
+    Entry *     find_entry(Bucket * bucket, uint64_t txn_id);
+    Bucket *    get_bucket(uint64_t txn_id);
+    void        latch(Bucket * bucket);
+    void        unlatch(Bucket * bucket);
+
+    Bucket **   _buckets;
+    uint32_t    _table_size;
+    pthread_mutex_t _validation_latch;
+};
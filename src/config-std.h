@@ -10,6 +10,20 @@
 // number of server threads on each node
 #define NUM_WORKER_THREADS              4096 //2048 //1024
 #define NUM_RPC_SERVER_THREADS          24
+// completion queues of the rpc server, over which its threads are spread, and
+// of the rpc client for each remote node, each drained by its own thread.
+#define NUM_RPC_SERVER_CQS              1
+#define NUM_RPC_CLIENT_CQS              1
+// pin each rpc server thread and client completion thread to its own core
+#define PIN_RPC_THREADS                 false
+// protobuf messages of a txn and of a server call are allocated on an arena
+// whose first block (in bytes) is embedded in the TxnManager / CallData.
+#define TXN_ARENA_SIZE                  8192
+#define RPC_CALL_ARENA_SIZE             2048
+// send the write tuples of prepare requests by reference: the payloads are
+// spliced into the serialized request from the access set instead of being
+// copied into the message first.
+#define ZERO_COPY_TUPLES                false
 
 // Statistics
 // ==========
@@ -31,7 +45,8 @@
 
 // Concurrency Control
 // ===================
-// Supported concurrency control algorithms: WAIT_DIE, NO_WAIT, TICTOC, F_ONE
+// Supported concurrency control algorithms: WAIT_DIE, NO_WAIT, TICTOC, F_ONE, OCC, IDEAL_MVCC
+// Supported isolation levels: SERIALIZABLE, READ_COMMITTED (OCC), SNAPSHOT_ISOLATION (IDEAL_MVCC)
 #define ISOLATION_LEVEL                 SERIALIZABLE
 #define CC_ALG                          NO_WAIT
 #define ABORT_PENALTY                   10000000  // in nanoseconds
@@ -45,10 +60,36 @@
 #define EARLY_LOCK_RELEASE              false
 // [TIMESTAMP]
 #define TS_ALLOC                        TS_CLOCK
+// TS_CAS, TS_HLC: with TS_BATCH_ALLOC, a thread reserves TS_BATCH_NUM timestamps at a time
 #define TS_BATCH_ALLOC                  false
 #define TS_BATCH_NUM                    1
 // [MVCC]
 #define MIN_TS_INTVL                    5000000 //5 ms. In nanoseconds
+#define MVCC_GC_INTVL                   1000 // in us. sleep time between two garbage collection passes
+#define MVCC_READ_RETRY_DELAY           10 // in us. a remote read blocked by a committing writer is served again after it
+// [MAAT]
+// width of the commit timestamp range reserved by a validated transaction
+// whose range is not bounded by any other transaction.
+#define MAAT_RANGE_SIZE                 1000
+// [HOT KEY]
+// sample row lock conflicts and track the hottest keys of each node.
+// with HOT_KEY_BATCHING (requires HOT_KEY_TRACKING), txns writing the same
+// local hot key are queued and admitted one after another instead of racing
+// for the row lock.
+#define HOT_KEY_TRACKING                false
+#define HOT_KEY_BATCHING                false
+#define HOT_KEY_SAMPLE_RATE             4 // record one out of N conflicts
+#define HOT_KEY_SKETCH_SIZE             64 // counters per thread
+#define HOT_KEY_MERGE_INTVL             100000 // in us
+#define HOT_KEY_THRESHOLD               16 // min merged count of a hot key
+// [DETERMINISTIC]
+// Calvin-style execution: each node groups DET_EPOCH_SIZE generated txns into
+// an epoch, logs the epoch input once and runs the txns in a conflict order
+// derived from their key sets, without row locks or per-txn commit logging.
+// Requires single-partition txns (YCSB with SINGLE_PART_ONLY, or NUM_NODES 1), CC_ALG
+// NO_WAIT or WAIT_DIE and no EARLY_LOCK_RELEASE.
+#define DETERMINISTIC                   false
+#define DET_EPOCH_SIZE                  100 // txns per epoch
 // [OCC]
 #define MAX_WRITE_SET                   10
 #define PER_ROW_VALID                   true
@@ -65,6 +106,10 @@
 // if SKIP_READONLY_PREPARE is true, then a readonly subtxn will forget
 // about its states after returning. If no renewal is required, this remote
 // node will not participate in the 2PC protocol.
+// Implemented for IDEAL_MVCC: the reads of a txn whose query is read-only are
+// served from the coordinator's snapshot and need no validation, so the
+// participants end their sub-txns with the READ_REQ and the coordinator
+// commits without a prepare round.
 #define SKIP_READONLY_PREPARE           false
 #define MAX_NUM_WAITS                   4
 #define READ_INTENSITY_THRESH           0.8
@@ -97,10 +142,33 @@
 // Logging
 // =======
 #define LOG_DEVICE                      LOG_DVC_REDIS
-#define LOG_DELAY                       0
+// emulated round trip between regions: unless NET_EMU_DELAY_MATRIX is set,
+// every link has a one-way latency of LOG_DELAY / 2, except between compute
+// node i and storage node i (same region) if UNIFORM_DELAY is false.
+#define LOG_DELAY                       0 // in us
+#define UNIFORM_DELAY                   false
 #define LOG_SIZE_PER_WRITE              32 // in bytes
 #define LOG_TLS_REDIS                   false // if redis needs tls tunnel
 #define AZURE_ISOLATION_ENABLE          true
+// [AZURE BATCHED LOG]
+// append the records of each node to one append blob in batches instead of
+// uploading blobs per txn. Ignores AZURE_ISOLATION_ENABLE.
+#define AZURE_BATCHED_LOG               false
+// max appends in flight
+#define AZURE_LOG_POOL_SIZE             8
+// max bytes of one append (the limit of an append block is 4MB)
+#define AZURE_MAX_APPEND_SIZE           (4UL * 1024 * 1024)
+// max txns whose status a client caches per node log. A conditional write to
+// an evicted txn rereads the log.
+#define AZURE_LOG_STATUS_CACHE_SIZE     (1UL << 20)
+// [LOCAL FILE LOG]
+// segments are written to the directory given by -Dl. The log of a node is
+// not readable by the others, so on compute nodes, where others must be able
+// to terminate the txns of a failed node, it is limited to a single node.
+// Storage nodes (serving LOG_DVC_CUSTOMIZED) replicate it through Paxos.
+#define LOCAL_LOG_SEGMENT_SIZE          (64UL * 1024 * 1024)
+// max bytes of one group commit
+#define LOCAL_LOG_BUFFER_SIZE           (4UL * 1024 * 1024)
 
 // Benchmark
 // =========
@@ -149,6 +217,72 @@
 #define COMMIT_ALG                      ONE_PC
 #define COMMIT_VAR                      NO_VARIANT
 #define DEBUG_LOG                       false
+// [ASYNC COMMIT]
+// once a commit decision is durable, the coordinator does not wait for the
+// COMMIT_REQ acks. The worker moves on and the txn is reclaimed when the last
+// ack arrives.
+#define ASYNC_COMMIT                    false
+// [EARLY CLIENT ACK]
+// with COMMIT_ALG = ONE_PC, a txn commits once all votes are durable. The
+// worker counts the commit right then and moves on; the decision log,
+// COMMIT_REQs and the cleanup of the txn complete in the background.
+#define EARLY_CLIENT_ACK                false
+// [2PC PRESUMPTION]
+// with COMMIT_ALG = TWO_PC, PRESUME_ABORT and PRESUME_COMMIT skip the log
+// writes the presumption makes unnecessary and write the decisions that
+// need not be forced lazily, in batches of LAZY_LOG_BATCH_SIZE records (or
+// what accumulated within LAZY_LOG_TIMEOUT).
+#define TWO_PC_PRESUME                  PRESUME_NOTHING
+#define LAZY_LOG_BATCH_SIZE             64
+#define LAZY_LOG_TIMEOUT                1000 // in us
+// [FAILURE DETECTOR]
+// compute nodes send each other a heartbeat every HEARTBEAT_INTERVAL; a node
+// that did not answer for HEARTBEAT_TIMEOUT is suspected to have failed, and
+// the txns blocked on it are terminated, TERMINATION_BATCH_SIZE at a time;
+// the lookups of a batch on the log of each node are sent as one request.
+#define FAILURE_DETECTOR                false
+#define HEARTBEAT_INTERVAL              10000 // in us
+#define HEARTBEAT_TIMEOUT               100000 // in us
+#define TERMINATION_BATCH_SIZE          64
+// [FAILURE INJECTION]
+// compute node FAILURE_NODE fails FAILURE_TIMEPOINT seconds into the run: it
+// stops logging, sending requests and answering heartbeats.
+#define FAILURE_ENABLE                  false
+#define FAILURE_NODE                    1
+#define FAILURE_TIMEPOINT               1 // in second
+#define DEBUG_FAILURE                   false
+// [PIPELINED READS]
+// store procedures send their remote reads first and only wait for them
+// where the remote data is used, so local accesses overlap the round trip.
+#define PIPELINED_REMOTE_READS          false
+// [RPC BATCHING]
+// coalesce the async READ/PREPARE/COMMIT/ABORT requests of different txns
+// bound for the same node into one BATCH_REQ. A batch is sent once it holds
+// RPC_BATCH_SIZE requests or its oldest request waited RPC_BATCH_TIMEOUT.
+#define RPC_BATCHING                    false
+#define RPC_BATCH_SIZE                  16
+#define RPC_BATCH_TIMEOUT               20 // in us
+// [PAXOS]
+// a storage node replicates the PAXOS_LOG records it leads through a
+// Multi-Paxos log: records are grouped into entries, and several entries are
+// replicated at the same time.
+#define PAXOS_BATCH_SIZE                32 // max records per log entry
+#define PAXOS_BATCH_TIMEOUT             50 // in us
+#define PAXOS_MAX_INFLIGHT              8 // entries being replicated
+// [NETWORK EMULATION]
+// delay the messages of the rpc client as if they went over a slower link:
+// each message takes NET_EMU_LATENCY plus up to NET_EMU_JITTER one way, and
+// messages on the same link are serialized at NET_EMU_BANDWIDTH. Used to run
+// a cluster on one host (see run_local_cluster.py). 0 disables a parameter.
+#define NET_EMU_LATENCY                 0 // in us
+#define NET_EMU_JITTER                  0 // in us
+#define NET_EMU_BANDWIDTH               0 // in Mbps
+// with NET_EMU_DELAY_MATRIX, the one-way latency of each (source,
+// destination) link is read from the matrix file (-Dd, default
+// delay_matrix.txt) instead of NET_EMU_LATENCY.
+#define NET_EMU_DELAY_MATRIX            false
+// granularity of the timer wheel releasing delayed messages
+#define NET_EMU_TICK                    10 // in us
 
 // Constant
 // ========
@@ -173,6 +307,7 @@
 #define TS_CAS                          2
 #define TS_HW                           3
 #define TS_CLOCK                        4
+#define TS_HLC                          5    // hybrid logical clock
 // Caching policy
 #define ALWAYS_READ                     1    // always read cached data
 #define ALWAYS_CHECK                    2    // always contact remote node
@@ -188,14 +323,20 @@
 #define PAXOS_COMMIT                    4
 #define MDCC_CLASSIC                    5
 #define MDCC_FAST                       6
+// 2PC Presumption
+#define PRESUME_NOTHING                 1
+#define PRESUME_ABORT                   2
+#define PRESUME_COMMIT                  3
 
 // Log Device
 #define LOG_DVC_REDIS                   1
 #define LOG_DVC_AZURE_BLOB              2
 #define LOG_DVC_CUSTOMIZED              3
+#define LOG_DVC_LOCAL_FILE              4
 // Isolation Level
 #define SERIALIZABLE                    1
 #define READ_COMMITTED                  2
+#define SNAPSHOT_ISOLATION              3
 // Node Type
 #define COMPUTE_NODE                    1
 #define STORAGE_NODE                    2
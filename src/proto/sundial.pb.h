@@ -1,2884 +0,0 @@
-// Generated by the protocol buffer compiler.  DO NOT EDIT!
-// source: sundial.proto
-
-#ifndef GOOGLE_PROTOBUF_INCLUDED_sundial_2eproto
-#define GOOGLE_PROTOBUF_INCLUDED_sundial_2eproto
-
-#include <limits>
-#include <string>
-
-#include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3019000
-#error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers. Please update
-#error your headers.
-#endif
-#if 3019004 < PROTOBUF_MIN_PROTOC_VERSION
-#error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers. Please
-#error regenerate this file with a newer version of protoc.
-#endif
-
-#include <google/protobuf/port_undef.inc>
-#include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/arena.h>
-#include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
-#include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/metadata_lite.h>
-#include <google/protobuf/generated_message_reflection.h>
-#include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
-#include <google/protobuf/extension_set.h>  // IWYU pragma: export
-#include <google/protobuf/generated_enum_reflection.h>
-#include <google/protobuf/unknown_field_set.h>
-// @@protoc_insertion_point(includes)
-#include <google/protobuf/port_def.inc>
-#define PROTOBUF_INTERNAL_EXPORT_sundial_2eproto
-PROTOBUF_NAMESPACE_OPEN
-namespace internal {
-class AnyMetadata;
-}  // namespace internal
-PROTOBUF_NAMESPACE_CLOSE
-
-// Internal implementation detail -- do not use these members.
-struct TableStruct_sundial_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[6]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const uint32_t offsets[];
-};
-extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_sundial_2eproto;
-namespace sundial_rpc {
-class SundialRequest;
-struct SundialRequestDefaultTypeInternal;
-extern SundialRequestDefaultTypeInternal _SundialRequest_default_instance_;
-class SundialRequest_NodeData;
-struct SundialRequest_NodeDataDefaultTypeInternal;
-extern SundialRequest_NodeDataDefaultTypeInternal _SundialRequest_NodeData_default_instance_;
-class SundialRequest_ReadRequest;
-struct SundialRequest_ReadRequestDefaultTypeInternal;
-extern SundialRequest_ReadRequestDefaultTypeInternal _SundialRequest_ReadRequest_default_instance_;
-class SundialRequest_TupleData;
-struct SundialRequest_TupleDataDefaultTypeInternal;
-extern SundialRequest_TupleDataDefaultTypeInternal _SundialRequest_TupleData_default_instance_;
-class SundialResponse;
-struct SundialResponseDefaultTypeInternal;
-extern SundialResponseDefaultTypeInternal _SundialResponse_default_instance_;
-class SundialResponse_TupleData;
-struct SundialResponse_TupleDataDefaultTypeInternal;
-extern SundialResponse_TupleDataDefaultTypeInternal _SundialResponse_TupleData_default_instance_;
-}  // namespace sundial_rpc
-PROTOBUF_NAMESPACE_OPEN
-template<> ::sundial_rpc::SundialRequest* Arena::CreateMaybeMessage<::sundial_rpc::SundialRequest>(Arena*);
-template<> ::sundial_rpc::SundialRequest_NodeData* Arena::CreateMaybeMessage<::sundial_rpc::SundialRequest_NodeData>(Arena*);
-template<> ::sundial_rpc::SundialRequest_ReadRequest* Arena::CreateMaybeMessage<::sundial_rpc::SundialRequest_ReadRequest>(Arena*);
-template<> ::sundial_rpc::SundialRequest_TupleData* Arena::CreateMaybeMessage<::sundial_rpc::SundialRequest_TupleData>(Arena*);
-template<> ::sundial_rpc::SundialResponse* Arena::CreateMaybeMessage<::sundial_rpc::SundialResponse>(Arena*);
-template<> ::sundial_rpc::SundialResponse_TupleData* Arena::CreateMaybeMessage<::sundial_rpc::SundialResponse_TupleData>(Arena*);
-PROTOBUF_NAMESPACE_CLOSE
-namespace sundial_rpc {
-
-enum SundialRequest_RequestType : int {
-  SundialRequest_RequestType_DummyReply = 0,
-  SundialRequest_RequestType_READ_REQ = 1,
-  SundialRequest_RequestType_PREPARE_REQ = 2,
-  SundialRequest_RequestType_COMMIT_REQ = 3,
-  SundialRequest_RequestType_ABORT_REQ = 4,
-  SundialRequest_RequestType_SYS_REQ = 5,
-  SundialRequest_RequestType_TERMINATE_REQ = 6,
-  SundialRequest_RequestType_PAXOS_LOG = 7,
-  SundialRequest_RequestType_PAXOS_LOG_FORWARD = 8,
-  SundialRequest_RequestType_PAXOS_LOG_COLOCATE = 9,
-  SundialRequest_RequestType_PAXOS_LOG_COLOCATE_FORWARD = 10,
-  SundialRequest_RequestType_PAXOS_REPLICATE = 11,
-  SundialRequest_RequestType_NUM_REQ_TYPES = 12,
-  SundialRequest_RequestType_SundialRequest_RequestType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
-  SundialRequest_RequestType_SundialRequest_RequestType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
-};
-bool SundialRequest_RequestType_IsValid(int value);
-constexpr SundialRequest_RequestType SundialRequest_RequestType_RequestType_MIN = SundialRequest_RequestType_DummyReply;
-constexpr SundialRequest_RequestType SundialRequest_RequestType_RequestType_MAX = SundialRequest_RequestType_NUM_REQ_TYPES;
-constexpr int SundialRequest_RequestType_RequestType_ARRAYSIZE = SundialRequest_RequestType_RequestType_MAX + 1;
-
-const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SundialRequest_RequestType_descriptor();
-template<typename T>
-inline const std::string& SundialRequest_RequestType_Name(T enum_t_value) {
-  static_assert(::std::is_same<T, SundialRequest_RequestType>::value ||
-    ::std::is_integral<T>::value,
-    "Incorrect type passed to function SundialRequest_RequestType_Name.");
-  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
-    SundialRequest_RequestType_descriptor(), enum_t_value);
-}
-inline bool SundialRequest_RequestType_Parse(
-    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SundialRequest_RequestType* value) {
-  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SundialRequest_RequestType>(
-    SundialRequest_RequestType_descriptor(), name, value);
-}
-enum SundialRequest_NodeType : int {
-  SundialRequest_NodeType_COORDINATOR = 0,
-  SundialRequest_NodeType_PARTICIPANT = 1,
-  SundialRequest_NodeType_STORAGE = 2,
-  SundialRequest_NodeType_SundialRequest_NodeType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
-  SundialRequest_NodeType_SundialRequest_NodeType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
-};
-bool SundialRequest_NodeType_IsValid(int value);
-constexpr SundialRequest_NodeType SundialRequest_NodeType_NodeType_MIN = SundialRequest_NodeType_COORDINATOR;
-constexpr SundialRequest_NodeType SundialRequest_NodeType_NodeType_MAX = SundialRequest_NodeType_STORAGE;
-constexpr int SundialRequest_NodeType_NodeType_ARRAYSIZE = SundialRequest_NodeType_NodeType_MAX + 1;
-
-const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SundialRequest_NodeType_descriptor();
-template<typename T>
-inline const std::string& SundialRequest_NodeType_Name(T enum_t_value) {
-  static_assert(::std::is_same<T, SundialRequest_NodeType>::value ||
-    ::std::is_integral<T>::value,
-    "Incorrect type passed to function SundialRequest_NodeType_Name.");
-  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
-    SundialRequest_NodeType_descriptor(), enum_t_value);
-}
-inline bool SundialRequest_NodeType_Parse(
-    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SundialRequest_NodeType* value) {
-  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SundialRequest_NodeType>(
-    SundialRequest_NodeType_descriptor(), name, value);
-}
-enum SundialRequest_ResponseType : int {
-  SundialRequest_ResponseType_RESP_OK = 0,
-  SundialRequest_ResponseType_RESP_ABORT = 1,
-  SundialRequest_ResponseType_RESP_FAIL = 2,
-  SundialRequest_ResponseType_PREPARED_OK = 3,
-  SundialRequest_ResponseType_PREPARED_OK_RO = 4,
-  SundialRequest_ResponseType_PREPARED_ABORT = 5,
-  SundialRequest_ResponseType_ACK = 6,
-  SundialRequest_ResponseType_SYS_RESP = 7,
-  SundialRequest_ResponseType_NUM_RESP_TYPES = 8,
-  SundialRequest_ResponseType_SundialRequest_ResponseType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
-  SundialRequest_ResponseType_SundialRequest_ResponseType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
-};
-bool SundialRequest_ResponseType_IsValid(int value);
-constexpr SundialRequest_ResponseType SundialRequest_ResponseType_ResponseType_MIN = SundialRequest_ResponseType_RESP_OK;
-constexpr SundialRequest_ResponseType SundialRequest_ResponseType_ResponseType_MAX = SundialRequest_ResponseType_NUM_RESP_TYPES;
-constexpr int SundialRequest_ResponseType_ResponseType_ARRAYSIZE = SundialRequest_ResponseType_ResponseType_MAX + 1;
-
-const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SundialRequest_ResponseType_descriptor();
-template<typename T>
-inline const std::string& SundialRequest_ResponseType_Name(T enum_t_value) {
-  static_assert(::std::is_same<T, SundialRequest_ResponseType>::value ||
-    ::std::is_integral<T>::value,
-    "Incorrect type passed to function SundialRequest_ResponseType_Name.");
-  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
-    SundialRequest_ResponseType_descriptor(), enum_t_value);
-}
-inline bool SundialRequest_ResponseType_Parse(
-    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SundialRequest_ResponseType* value) {
-  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SundialRequest_ResponseType>(
-    SundialRequest_ResponseType_descriptor(), name, value);
-}
-enum SundialResponse_RequestType : int {
-  SundialResponse_RequestType_DummyReply = 0,
-  SundialResponse_RequestType_READ_REQ = 1,
-  SundialResponse_RequestType_PREPARE_REQ = 2,
-  SundialResponse_RequestType_COMMIT_REQ = 3,
-  SundialResponse_RequestType_ABORT_REQ = 4,
-  SundialResponse_RequestType_SYS_REQ = 5,
-  SundialResponse_RequestType_TERMINATE_REQ = 6,
-  SundialResponse_RequestType_PAXOS_LOG_ACK = 7,
-  SundialResponse_RequestType_PAXOS_FORWARD_ACK = 8,
-  SundialResponse_RequestType_NUM_REQ_TYPES = 9,
-  SundialResponse_RequestType_SundialResponse_RequestType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
-  SundialResponse_RequestType_SundialResponse_RequestType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
-};
-bool SundialResponse_RequestType_IsValid(int value);
-constexpr SundialResponse_RequestType SundialResponse_RequestType_RequestType_MIN = SundialResponse_RequestType_DummyReply;
-constexpr SundialResponse_RequestType SundialResponse_RequestType_RequestType_MAX = SundialResponse_RequestType_NUM_REQ_TYPES;
-constexpr int SundialResponse_RequestType_RequestType_ARRAYSIZE = SundialResponse_RequestType_RequestType_MAX + 1;
-
-const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SundialResponse_RequestType_descriptor();
-template<typename T>
-inline const std::string& SundialResponse_RequestType_Name(T enum_t_value) {
-  static_assert(::std::is_same<T, SundialResponse_RequestType>::value ||
-    ::std::is_integral<T>::value,
-    "Incorrect type passed to function SundialResponse_RequestType_Name.");
-  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
-    SundialResponse_RequestType_descriptor(), enum_t_value);
-}
-inline bool SundialResponse_RequestType_Parse(
-    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SundialResponse_RequestType* value) {
-  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SundialResponse_RequestType>(
-    SundialResponse_RequestType_descriptor(), name, value);
-}
-enum SundialResponse_ResponseType : int {
-  SundialResponse_ResponseType_RESP_OK = 0,
-  SundialResponse_ResponseType_RESP_ABORT = 1,
-  SundialResponse_ResponseType_RESP_FAIL = 2,
-  SundialResponse_ResponseType_PREPARED_OK = 3,
-  SundialResponse_ResponseType_PREPARED_OK_RO = 4,
-  SundialResponse_ResponseType_PREPARED_ABORT = 5,
-  SundialResponse_ResponseType_ACK = 6,
-  SundialResponse_ResponseType_SYS_RESP = 7,
-  SundialResponse_ResponseType_NUM_RESP_TYPES = 8,
-  SundialResponse_ResponseType_SundialResponse_ResponseType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
-  SundialResponse_ResponseType_SundialResponse_ResponseType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
-};
-bool SundialResponse_ResponseType_IsValid(int value);
-constexpr SundialResponse_ResponseType SundialResponse_ResponseType_ResponseType_MIN = SundialResponse_ResponseType_RESP_OK;
-constexpr SundialResponse_ResponseType SundialResponse_ResponseType_ResponseType_MAX = SundialResponse_ResponseType_NUM_RESP_TYPES;
-constexpr int SundialResponse_ResponseType_ResponseType_ARRAYSIZE = SundialResponse_ResponseType_ResponseType_MAX + 1;
-
-const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SundialResponse_ResponseType_descriptor();
-template<typename T>
-inline const std::string& SundialResponse_ResponseType_Name(T enum_t_value) {
-  static_assert(::std::is_same<T, SundialResponse_ResponseType>::value ||
-    ::std::is_integral<T>::value,
-    "Incorrect type passed to function SundialResponse_ResponseType_Name.");
-  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
-    SundialResponse_ResponseType_descriptor(), enum_t_value);
-}
-inline bool SundialResponse_ResponseType_Parse(
-    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SundialResponse_ResponseType* value) {
-  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SundialResponse_ResponseType>(
-    SundialResponse_ResponseType_descriptor(), name, value);
-}
-enum SundialResponse_NodeType : int {
-  SundialResponse_NodeType_COORDINATOR = 0,
-  SundialResponse_NodeType_PARTICIPANT = 1,
-  SundialResponse_NodeType_STORAGE = 2,
-  SundialResponse_NodeType_SundialResponse_NodeType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
-  SundialResponse_NodeType_SundialResponse_NodeType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
-};
-bool SundialResponse_NodeType_IsValid(int value);
-constexpr SundialResponse_NodeType SundialResponse_NodeType_NodeType_MIN = SundialResponse_NodeType_COORDINATOR;
-constexpr SundialResponse_NodeType SundialResponse_NodeType_NodeType_MAX = SundialResponse_NodeType_STORAGE;
-constexpr int SundialResponse_NodeType_NodeType_ARRAYSIZE = SundialResponse_NodeType_NodeType_MAX + 1;
-
-const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SundialResponse_NodeType_descriptor();
-template<typename T>
-inline const std::string& SundialResponse_NodeType_Name(T enum_t_value) {
-  static_assert(::std::is_same<T, SundialResponse_NodeType>::value ||
-    ::std::is_integral<T>::value,
-    "Incorrect type passed to function SundialResponse_NodeType_Name.");
-  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
-    SundialResponse_NodeType_descriptor(), enum_t_value);
-}
-inline bool SundialResponse_NodeType_Parse(
-    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SundialResponse_NodeType* value) {
-  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SundialResponse_NodeType>(
-    SundialResponse_NodeType_descriptor(), name, value);
-}
-// ===================================================================
-
-class SundialRequest_ReadRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sundial_rpc.SundialRequest.ReadRequest) */ {
- public:
-  inline SundialRequest_ReadRequest() : SundialRequest_ReadRequest(nullptr) {}
-  ~SundialRequest_ReadRequest() override;
-  explicit constexpr SundialRequest_ReadRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
-
-  SundialRequest_ReadRequest(const SundialRequest_ReadRequest& from);
-  SundialRequest_ReadRequest(SundialRequest_ReadRequest&& from) noexcept
-    : SundialRequest_ReadRequest() {
-    *this = ::std::move(from);
-  }
-
-  inline SundialRequest_ReadRequest& operator=(const SundialRequest_ReadRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline SundialRequest_ReadRequest& operator=(SundialRequest_ReadRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (GetOwningArena() == from.GetOwningArena()
-  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
-        && GetOwningArena() != nullptr
-  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
-    ) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const SundialRequest_ReadRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const SundialRequest_ReadRequest* internal_default_instance() {
-    return reinterpret_cast<const SundialRequest_ReadRequest*>(
-               &_SundialRequest_ReadRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    0;
-
-  friend void swap(SundialRequest_ReadRequest& a, SundialRequest_ReadRequest& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(SundialRequest_ReadRequest* other) {
-    if (other == this) return;
-  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() != nullptr &&
-        GetOwningArena() == other->GetOwningArena()) {
-   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() == other->GetOwningArena()) {
-  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
-      InternalSwap(other);
-    } else {
-      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(SundialRequest_ReadRequest* other) {
-    if (other == this) return;
-    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  SundialRequest_ReadRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SundialRequest_ReadRequest>(arena);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const SundialRequest_ReadRequest& from);
-  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const SundialRequest_ReadRequest& from);
-  private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
-  public:
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  uint8_t* _InternalSerialize(
-      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(SundialRequest_ReadRequest* other);
-
-  private:
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "sundial_rpc.SundialRequest.ReadRequest";
-  }
-  protected:
-  explicit SundialRequest_ReadRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                       bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  public:
-
-  static const ClassData _class_data_;
-  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kKeyFieldNumber = 1,
-    kIndexIdFieldNumber = 2,
-    kAccessTypeFieldNumber = 3,
-  };
-  // uint64 key = 1;
-  void clear_key();
-  uint64_t key() const;
-  void set_key(uint64_t value);
-  private:
-  uint64_t _internal_key() const;
-  void _internal_set_key(uint64_t value);
-  public:
-
-  // uint64 index_id = 2;
-  void clear_index_id();
-  uint64_t index_id() const;
-  void set_index_id(uint64_t value);
-  private:
-  uint64_t _internal_index_id() const;
-  void _internal_set_index_id(uint64_t value);
-  public:
-
-  // uint64 access_type = 3;
-  void clear_access_type();
-  uint64_t access_type() const;
-  void set_access_type(uint64_t value);
-  private:
-  uint64_t _internal_access_type() const;
-  void _internal_set_access_type(uint64_t value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:sundial_rpc.SundialRequest.ReadRequest)
- private:
-  class _Internal;
-
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  uint64_t key_;
-  uint64_t index_id_;
-  uint64_t access_type_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_sundial_2eproto;
-};
-// -------------------------------------------------------------------
-
-class SundialRequest_TupleData final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sundial_rpc.SundialRequest.TupleData) */ {
- public:
-  inline SundialRequest_TupleData() : SundialRequest_TupleData(nullptr) {}
-  ~SundialRequest_TupleData() override;
-  explicit constexpr SundialRequest_TupleData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
-
-  SundialRequest_TupleData(const SundialRequest_TupleData& from);
-  SundialRequest_TupleData(SundialRequest_TupleData&& from) noexcept
-    : SundialRequest_TupleData() {
-    *this = ::std::move(from);
-  }
-
-  inline SundialRequest_TupleData& operator=(const SundialRequest_TupleData& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline SundialRequest_TupleData& operator=(SundialRequest_TupleData&& from) noexcept {
-    if (this == &from) return *this;
-    if (GetOwningArena() == from.GetOwningArena()
-  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
-        && GetOwningArena() != nullptr
-  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
-    ) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const SundialRequest_TupleData& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const SundialRequest_TupleData* internal_default_instance() {
-    return reinterpret_cast<const SundialRequest_TupleData*>(
-               &_SundialRequest_TupleData_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    1;
-
-  friend void swap(SundialRequest_TupleData& a, SundialRequest_TupleData& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(SundialRequest_TupleData* other) {
-    if (other == this) return;
-  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() != nullptr &&
-        GetOwningArena() == other->GetOwningArena()) {
-   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() == other->GetOwningArena()) {
-  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
-      InternalSwap(other);
-    } else {
-      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(SundialRequest_TupleData* other) {
-    if (other == this) return;
-    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  SundialRequest_TupleData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SundialRequest_TupleData>(arena);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const SundialRequest_TupleData& from);
-  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const SundialRequest_TupleData& from);
-  private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
-  public:
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  uint8_t* _InternalSerialize(
-      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(SundialRequest_TupleData* other);
-
-  private:
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "sundial_rpc.SundialRequest.TupleData";
-  }
-  protected:
-  explicit SundialRequest_TupleData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                       bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  public:
-
-  static const ClassData _class_data_;
-  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kDataFieldNumber = 4,
-    kKeyFieldNumber = 1,
-    kTableIdFieldNumber = 2,
-    kSizeFieldNumber = 3,
-    kAccessTypeFieldNumber = 5,
-    kVersionFieldNumber = 6,
-    kIndexIdFieldNumber = 7,
-  };
-  // bytes data = 4;
-  void clear_data();
-  const std::string& data() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_data(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_data();
-  PROTOBUF_NODISCARD std::string* release_data();
-  void set_allocated_data(std::string* data);
-  private:
-  const std::string& _internal_data() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
-  std::string* _internal_mutable_data();
-  public:
-
-  // uint64 key = 1;
-  void clear_key();
-  uint64_t key() const;
-  void set_key(uint64_t value);
-  private:
-  uint64_t _internal_key() const;
-  void _internal_set_key(uint64_t value);
-  public:
-
-  // uint64 table_id = 2;
-  void clear_table_id();
-  uint64_t table_id() const;
-  void set_table_id(uint64_t value);
-  private:
-  uint64_t _internal_table_id() const;
-  void _internal_set_table_id(uint64_t value);
-  public:
-
-  // uint64 size = 3;
-  void clear_size();
-  uint64_t size() const;
-  void set_size(uint64_t value);
-  private:
-  uint64_t _internal_size() const;
-  void _internal_set_size(uint64_t value);
-  public:
-
-  // uint64 access_type = 5;
-  void clear_access_type();
-  uint64_t access_type() const;
-  void set_access_type(uint64_t value);
-  private:
-  uint64_t _internal_access_type() const;
-  void _internal_set_access_type(uint64_t value);
-  public:
-
-  // uint64 version = 6;
-  void clear_version();
-  uint64_t version() const;
-  void set_version(uint64_t value);
-  private:
-  uint64_t _internal_version() const;
-  void _internal_set_version(uint64_t value);
-  public:
-
-  // uint64 index_id = 7;
-  void clear_index_id();
-  uint64_t index_id() const;
-  void set_index_id(uint64_t value);
-  private:
-  uint64_t _internal_index_id() const;
-  void _internal_set_index_id(uint64_t value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:sundial_rpc.SundialRequest.TupleData)
- private:
-  class _Internal;
-
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
-  uint64_t key_;
-  uint64_t table_id_;
-  uint64_t size_;
-  uint64_t access_type_;
-  uint64_t version_;
-  uint64_t index_id_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_sundial_2eproto;
-};
-// -------------------------------------------------------------------
-
-class SundialRequest_NodeData final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sundial_rpc.SundialRequest.NodeData) */ {
- public:
-  inline SundialRequest_NodeData() : SundialRequest_NodeData(nullptr) {}
-  ~SundialRequest_NodeData() override;
-  explicit constexpr SundialRequest_NodeData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
-
-  SundialRequest_NodeData(const SundialRequest_NodeData& from);
-  SundialRequest_NodeData(SundialRequest_NodeData&& from) noexcept
-    : SundialRequest_NodeData() {
-    *this = ::std::move(from);
-  }
-
-  inline SundialRequest_NodeData& operator=(const SundialRequest_NodeData& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline SundialRequest_NodeData& operator=(SundialRequest_NodeData&& from) noexcept {
-    if (this == &from) return *this;
-    if (GetOwningArena() == from.GetOwningArena()
-  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
-        && GetOwningArena() != nullptr
-  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
-    ) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const SundialRequest_NodeData& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const SundialRequest_NodeData* internal_default_instance() {
-    return reinterpret_cast<const SundialRequest_NodeData*>(
-               &_SundialRequest_NodeData_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    2;
-
-  friend void swap(SundialRequest_NodeData& a, SundialRequest_NodeData& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(SundialRequest_NodeData* other) {
-    if (other == this) return;
-  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() != nullptr &&
-        GetOwningArena() == other->GetOwningArena()) {
-   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() == other->GetOwningArena()) {
-  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
-      InternalSwap(other);
-    } else {
-      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(SundialRequest_NodeData* other) {
-    if (other == this) return;
-    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  SundialRequest_NodeData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SundialRequest_NodeData>(arena);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const SundialRequest_NodeData& from);
-  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const SundialRequest_NodeData& from);
-  private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
-  public:
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  uint8_t* _InternalSerialize(
-      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(SundialRequest_NodeData* other);
-
-  private:
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "sundial_rpc.SundialRequest.NodeData";
-  }
-  protected:
-  explicit SundialRequest_NodeData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                       bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  public:
-
-  static const ClassData _class_data_;
-  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kNidFieldNumber = 1,
-  };
-  // uint64 nid = 1;
-  void clear_nid();
-  uint64_t nid() const;
-  void set_nid(uint64_t value);
-  private:
-  uint64_t _internal_nid() const;
-  void _internal_set_nid(uint64_t value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:sundial_rpc.SundialRequest.NodeData)
- private:
-  class _Internal;
-
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  uint64_t nid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_sundial_2eproto;
-};
-// -------------------------------------------------------------------
-
-class SundialRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sundial_rpc.SundialRequest) */ {
- public:
-  inline SundialRequest() : SundialRequest(nullptr) {}
-  ~SundialRequest() override;
-  explicit constexpr SundialRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
-
-  SundialRequest(const SundialRequest& from);
-  SundialRequest(SundialRequest&& from) noexcept
-    : SundialRequest() {
-    *this = ::std::move(from);
-  }
-
-  inline SundialRequest& operator=(const SundialRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline SundialRequest& operator=(SundialRequest&& from) noexcept {
-    if (this == &from) return *this;
-    if (GetOwningArena() == from.GetOwningArena()
-  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
-        && GetOwningArena() != nullptr
-  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
-    ) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const SundialRequest& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const SundialRequest* internal_default_instance() {
-    return reinterpret_cast<const SundialRequest*>(
-               &_SundialRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    3;
-
-  friend void swap(SundialRequest& a, SundialRequest& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(SundialRequest* other) {
-    if (other == this) return;
-  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() != nullptr &&
-        GetOwningArena() == other->GetOwningArena()) {
-   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() == other->GetOwningArena()) {
-  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
-      InternalSwap(other);
-    } else {
-      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(SundialRequest* other) {
-    if (other == this) return;
-    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  SundialRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SundialRequest>(arena);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const SundialRequest& from);
-  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const SundialRequest& from);
-  private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
-  public:
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  uint8_t* _InternalSerialize(
-      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(SundialRequest* other);
-
-  private:
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "sundial_rpc.SundialRequest";
-  }
-  protected:
-  explicit SundialRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                       bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  public:
-
-  static const ClassData _class_data_;
-  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-
-  // nested types ----------------------------------------------------
-
-  typedef SundialRequest_ReadRequest ReadRequest;
-  typedef SundialRequest_TupleData TupleData;
-  typedef SundialRequest_NodeData NodeData;
-
-  typedef SundialRequest_RequestType RequestType;
-  static constexpr RequestType DummyReply =
-    SundialRequest_RequestType_DummyReply;
-  static constexpr RequestType READ_REQ =
-    SundialRequest_RequestType_READ_REQ;
-  static constexpr RequestType PREPARE_REQ =
-    SundialRequest_RequestType_PREPARE_REQ;
-  static constexpr RequestType COMMIT_REQ =
-    SundialRequest_RequestType_COMMIT_REQ;
-  static constexpr RequestType ABORT_REQ =
-    SundialRequest_RequestType_ABORT_REQ;
-  static constexpr RequestType SYS_REQ =
-    SundialRequest_RequestType_SYS_REQ;
-  static constexpr RequestType TERMINATE_REQ =
-    SundialRequest_RequestType_TERMINATE_REQ;
-  static constexpr RequestType PAXOS_LOG =
-    SundialRequest_RequestType_PAXOS_LOG;
-  static constexpr RequestType PAXOS_LOG_FORWARD =
-    SundialRequest_RequestType_PAXOS_LOG_FORWARD;
-  static constexpr RequestType PAXOS_LOG_COLOCATE =
-    SundialRequest_RequestType_PAXOS_LOG_COLOCATE;
-  static constexpr RequestType PAXOS_LOG_COLOCATE_FORWARD =
-    SundialRequest_RequestType_PAXOS_LOG_COLOCATE_FORWARD;
-  static constexpr RequestType PAXOS_REPLICATE =
-    SundialRequest_RequestType_PAXOS_REPLICATE;
-  static constexpr RequestType NUM_REQ_TYPES =
-    SundialRequest_RequestType_NUM_REQ_TYPES;
-  static inline bool RequestType_IsValid(int value) {
-    return SundialRequest_RequestType_IsValid(value);
-  }
-  static constexpr RequestType RequestType_MIN =
-    SundialRequest_RequestType_RequestType_MIN;
-  static constexpr RequestType RequestType_MAX =
-    SundialRequest_RequestType_RequestType_MAX;
-  static constexpr int RequestType_ARRAYSIZE =
-    SundialRequest_RequestType_RequestType_ARRAYSIZE;
-  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
-  RequestType_descriptor() {
-    return SundialRequest_RequestType_descriptor();
-  }
-  template<typename T>
-  static inline const std::string& RequestType_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, RequestType>::value ||
-      ::std::is_integral<T>::value,
-      "Incorrect type passed to function RequestType_Name.");
-    return SundialRequest_RequestType_Name(enum_t_value);
-  }
-  static inline bool RequestType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
-      RequestType* value) {
-    return SundialRequest_RequestType_Parse(name, value);
-  }
-
-  typedef SundialRequest_NodeType NodeType;
-  static constexpr NodeType COORDINATOR =
-    SundialRequest_NodeType_COORDINATOR;
-  static constexpr NodeType PARTICIPANT =
-    SundialRequest_NodeType_PARTICIPANT;
-  static constexpr NodeType STORAGE =
-    SundialRequest_NodeType_STORAGE;
-  static inline bool NodeType_IsValid(int value) {
-    return SundialRequest_NodeType_IsValid(value);
-  }
-  static constexpr NodeType NodeType_MIN =
-    SundialRequest_NodeType_NodeType_MIN;
-  static constexpr NodeType NodeType_MAX =
-    SundialRequest_NodeType_NodeType_MAX;
-  static constexpr int NodeType_ARRAYSIZE =
-    SundialRequest_NodeType_NodeType_ARRAYSIZE;
-  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
-  NodeType_descriptor() {
-    return SundialRequest_NodeType_descriptor();
-  }
-  template<typename T>
-  static inline const std::string& NodeType_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, NodeType>::value ||
-      ::std::is_integral<T>::value,
-      "Incorrect type passed to function NodeType_Name.");
-    return SundialRequest_NodeType_Name(enum_t_value);
-  }
-  static inline bool NodeType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
-      NodeType* value) {
-    return SundialRequest_NodeType_Parse(name, value);
-  }
-
-  typedef SundialRequest_ResponseType ResponseType;
-  static constexpr ResponseType RESP_OK =
-    SundialRequest_ResponseType_RESP_OK;
-  static constexpr ResponseType RESP_ABORT =
-    SundialRequest_ResponseType_RESP_ABORT;
-  static constexpr ResponseType RESP_FAIL =
-    SundialRequest_ResponseType_RESP_FAIL;
-  static constexpr ResponseType PREPARED_OK =
-    SundialRequest_ResponseType_PREPARED_OK;
-  static constexpr ResponseType PREPARED_OK_RO =
-    SundialRequest_ResponseType_PREPARED_OK_RO;
-  static constexpr ResponseType PREPARED_ABORT =
-    SundialRequest_ResponseType_PREPARED_ABORT;
-  static constexpr ResponseType ACK =
-    SundialRequest_ResponseType_ACK;
-  static constexpr ResponseType SYS_RESP =
-    SundialRequest_ResponseType_SYS_RESP;
-  static constexpr ResponseType NUM_RESP_TYPES =
-    SundialRequest_ResponseType_NUM_RESP_TYPES;
-  static inline bool ResponseType_IsValid(int value) {
-    return SundialRequest_ResponseType_IsValid(value);
-  }
-  static constexpr ResponseType ResponseType_MIN =
-    SundialRequest_ResponseType_ResponseType_MIN;
-  static constexpr ResponseType ResponseType_MAX =
-    SundialRequest_ResponseType_ResponseType_MAX;
-  static constexpr int ResponseType_ARRAYSIZE =
-    SundialRequest_ResponseType_ResponseType_ARRAYSIZE;
-  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
-  ResponseType_descriptor() {
-    return SundialRequest_ResponseType_descriptor();
-  }
-  template<typename T>
-  static inline const std::string& ResponseType_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, ResponseType>::value ||
-      ::std::is_integral<T>::value,
-      "Incorrect type passed to function ResponseType_Name.");
-    return SundialRequest_ResponseType_Name(enum_t_value);
-  }
-  static inline bool ResponseType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
-      ResponseType* value) {
-    return SundialRequest_ResponseType_Parse(name, value);
-  }
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kReadRequestsFieldNumber = 3,
-    kTupleDataFieldNumber = 4,
-    kNodesFieldNumber = 7,
-    kTxnIdFieldNumber = 1,
-    kLogDataSizeFieldNumber = 5,
-    kNodeIdFieldNumber = 6,
-    kRequestTypeFieldNumber = 2,
-    kNodeTypeFieldNumber = 10,
-    kRequestTimeFieldNumber = 8,
-    kThreadIdFieldNumber = 9,
-    kCoordIdFieldNumber = 11,
-    kSemaphoreFieldNumber = 13,
-    kTxnStateFieldNumber = 12,
-    kThdIdFieldNumber = 14,
-    kReceiverIdFieldNumber = 16,
-    kForwardMsgFieldNumber = 15,
-  };
-  // repeated .sundial_rpc.SundialRequest.ReadRequest read_requests = 3;
-  int read_requests_size() const;
-  private:
-  int _internal_read_requests_size() const;
-  public:
-  void clear_read_requests();
-  ::sundial_rpc::SundialRequest_ReadRequest* mutable_read_requests(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sundial_rpc::SundialRequest_ReadRequest >*
-      mutable_read_requests();
-  private:
-  const ::sundial_rpc::SundialRequest_ReadRequest& _internal_read_requests(int index) const;
-  ::sundial_rpc::SundialRequest_ReadRequest* _internal_add_read_requests();
-  public:
-  const ::sundial_rpc::SundialRequest_ReadRequest& read_requests(int index) const;
-  ::sundial_rpc::SundialRequest_ReadRequest* add_read_requests();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sundial_rpc::SundialRequest_ReadRequest >&
-      read_requests() const;
-
-  // repeated .sundial_rpc.SundialRequest.TupleData tuple_data = 4;
-  int tuple_data_size() const;
-  private:
-  int _internal_tuple_data_size() const;
-  public:
-  void clear_tuple_data();
-  ::sundial_rpc::SundialRequest_TupleData* mutable_tuple_data(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sundial_rpc::SundialRequest_TupleData >*
-      mutable_tuple_data();
-  private:
-  const ::sundial_rpc::SundialRequest_TupleData& _internal_tuple_data(int index) const;
-  ::sundial_rpc::SundialRequest_TupleData* _internal_add_tuple_data();
-  public:
-  const ::sundial_rpc::SundialRequest_TupleData& tuple_data(int index) const;
-  ::sundial_rpc::SundialRequest_TupleData* add_tuple_data();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sundial_rpc::SundialRequest_TupleData >&
-      tuple_data() const;
-
-  // repeated .sundial_rpc.SundialRequest.NodeData nodes = 7;
-  int nodes_size() const;
-  private:
-  int _internal_nodes_size() const;
-  public:
-  void clear_nodes();
-  ::sundial_rpc::SundialRequest_NodeData* mutable_nodes(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sundial_rpc::SundialRequest_NodeData >*
-      mutable_nodes();
-  private:
-  const ::sundial_rpc::SundialRequest_NodeData& _internal_nodes(int index) const;
-  ::sundial_rpc::SundialRequest_NodeData* _internal_add_nodes();
-  public:
-  const ::sundial_rpc::SundialRequest_NodeData& nodes(int index) const;
-  ::sundial_rpc::SundialRequest_NodeData* add_nodes();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sundial_rpc::SundialRequest_NodeData >&
-      nodes() const;
-
-  // uint64 txn_id = 1;
-  void clear_txn_id();
-  uint64_t txn_id() const;
-  void set_txn_id(uint64_t value);
-  private:
-  uint64_t _internal_txn_id() const;
-  void _internal_set_txn_id(uint64_t value);
-  public:
-
-  // uint64 log_data_size = 5;
-  void clear_log_data_size();
-  uint64_t log_data_size() const;
-  void set_log_data_size(uint64_t value);
-  private:
-  uint64_t _internal_log_data_size() const;
-  void _internal_set_log_data_size(uint64_t value);
-  public:
-
-  // uint64 node_id = 6;
-  void clear_node_id();
-  uint64_t node_id() const;
-  void set_node_id(uint64_t value);
-  private:
-  uint64_t _internal_node_id() const;
-  void _internal_set_node_id(uint64_t value);
-  public:
-
-  // .sundial_rpc.SundialRequest.RequestType request_type = 2;
-  void clear_request_type();
-  ::sundial_rpc::SundialRequest_RequestType request_type() const;
-  void set_request_type(::sundial_rpc::SundialRequest_RequestType value);
-  private:
-  ::sundial_rpc::SundialRequest_RequestType _internal_request_type() const;
-  void _internal_set_request_type(::sundial_rpc::SundialRequest_RequestType value);
-  public:
-
-  // .sundial_rpc.SundialRequest.NodeType node_type = 10;
-  void clear_node_type();
-  ::sundial_rpc::SundialRequest_NodeType node_type() const;
-  void set_node_type(::sundial_rpc::SundialRequest_NodeType value);
-  private:
-  ::sundial_rpc::SundialRequest_NodeType _internal_node_type() const;
-  void _internal_set_node_type(::sundial_rpc::SundialRequest_NodeType value);
-  public:
-
-  // uint64 request_time = 8;
-  void clear_request_time();
-  uint64_t request_time() const;
-  void set_request_time(uint64_t value);
-  private:
-  uint64_t _internal_request_time() const;
-  void _internal_set_request_time(uint64_t value);
-  public:
-
-  // uint64 thread_id = 9;
-  void clear_thread_id();
-  uint64_t thread_id() const;
-  void set_thread_id(uint64_t value);
-  private:
-  uint64_t _internal_thread_id() const;
-  void _internal_set_thread_id(uint64_t value);
-  public:
-
-  // uint64 coord_id = 11;
-  void clear_coord_id();
-  uint64_t coord_id() const;
-  void set_coord_id(uint64_t value);
-  private:
-  uint64_t _internal_coord_id() const;
-  void _internal_set_coord_id(uint64_t value);
-  public:
-
-  // uint64 semaphore = 13;
-  void clear_semaphore();
-  uint64_t semaphore() const;
-  void set_semaphore(uint64_t value);
-  private:
-  uint64_t _internal_semaphore() const;
-  void _internal_set_semaphore(uint64_t value);
-  public:
-
-  // int32 txn_state = 12;
-  void clear_txn_state();
-  int32_t txn_state() const;
-  void set_txn_state(int32_t value);
-  private:
-  int32_t _internal_txn_state() const;
-  void _internal_set_txn_state(int32_t value);
-  public:
-
-  // uint32 thd_id = 14;
-  void clear_thd_id();
-  uint32_t thd_id() const;
-  void set_thd_id(uint32_t value);
-  private:
-  uint32_t _internal_thd_id() const;
-  void _internal_set_thd_id(uint32_t value);
-  public:
-
-  // uint64 receiver_id = 16;
-  void clear_receiver_id();
-  uint64_t receiver_id() const;
-  void set_receiver_id(uint64_t value);
-  private:
-  uint64_t _internal_receiver_id() const;
-  void _internal_set_receiver_id(uint64_t value);
-  public:
-
-  // .sundial_rpc.SundialRequest.ResponseType forward_msg = 15;
-  void clear_forward_msg();
-  ::sundial_rpc::SundialRequest_ResponseType forward_msg() const;
-  void set_forward_msg(::sundial_rpc::SundialRequest_ResponseType value);
-  private:
-  ::sundial_rpc::SundialRequest_ResponseType _internal_forward_msg() const;
-  void _internal_set_forward_msg(::sundial_rpc::SundialRequest_ResponseType value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:sundial_rpc.SundialRequest)
- private:
-  class _Internal;
-
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sundial_rpc::SundialRequest_ReadRequest > read_requests_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sundial_rpc::SundialRequest_TupleData > tuple_data_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sundial_rpc::SundialRequest_NodeData > nodes_;
-  uint64_t txn_id_;
-  uint64_t log_data_size_;
-  uint64_t node_id_;
-  int request_type_;
-  int node_type_;
-  uint64_t request_time_;
-  uint64_t thread_id_;
-  uint64_t coord_id_;
-  uint64_t semaphore_;
-  int32_t txn_state_;
-  uint32_t thd_id_;
-  uint64_t receiver_id_;
-  int forward_msg_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_sundial_2eproto;
-};
-// -------------------------------------------------------------------
-
-class SundialResponse_TupleData final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sundial_rpc.SundialResponse.TupleData) */ {
- public:
-  inline SundialResponse_TupleData() : SundialResponse_TupleData(nullptr) {}
-  ~SundialResponse_TupleData() override;
-  explicit constexpr SundialResponse_TupleData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
-
-  SundialResponse_TupleData(const SundialResponse_TupleData& from);
-  SundialResponse_TupleData(SundialResponse_TupleData&& from) noexcept
-    : SundialResponse_TupleData() {
-    *this = ::std::move(from);
-  }
-
-  inline SundialResponse_TupleData& operator=(const SundialResponse_TupleData& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline SundialResponse_TupleData& operator=(SundialResponse_TupleData&& from) noexcept {
-    if (this == &from) return *this;
-    if (GetOwningArena() == from.GetOwningArena()
-  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
-        && GetOwningArena() != nullptr
-  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
-    ) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const SundialResponse_TupleData& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const SundialResponse_TupleData* internal_default_instance() {
-    return reinterpret_cast<const SundialResponse_TupleData*>(
-               &_SundialResponse_TupleData_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    4;
-
-  friend void swap(SundialResponse_TupleData& a, SundialResponse_TupleData& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(SundialResponse_TupleData* other) {
-    if (other == this) return;
-  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() != nullptr &&
-        GetOwningArena() == other->GetOwningArena()) {
-   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() == other->GetOwningArena()) {
-  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
-      InternalSwap(other);
-    } else {
-      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(SundialResponse_TupleData* other) {
-    if (other == this) return;
-    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  SundialResponse_TupleData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SundialResponse_TupleData>(arena);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const SundialResponse_TupleData& from);
-  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const SundialResponse_TupleData& from);
-  private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
-  public:
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  uint8_t* _InternalSerialize(
-      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(SundialResponse_TupleData* other);
-
-  private:
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "sundial_rpc.SundialResponse.TupleData";
-  }
-  protected:
-  explicit SundialResponse_TupleData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                       bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  public:
-
-  static const ClassData _class_data_;
-  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kDataFieldNumber = 4,
-    kKeyFieldNumber = 1,
-    kTableIdFieldNumber = 2,
-    kSizeFieldNumber = 3,
-    kAccessTypeFieldNumber = 5,
-    kVersionFieldNumber = 6,
-    kIndexIdFieldNumber = 7,
-  };
-  // bytes data = 4;
-  void clear_data();
-  const std::string& data() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_data(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_data();
-  PROTOBUF_NODISCARD std::string* release_data();
-  void set_allocated_data(std::string* data);
-  private:
-  const std::string& _internal_data() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
-  std::string* _internal_mutable_data();
-  public:
-
-  // uint64 key = 1;
-  void clear_key();
-  uint64_t key() const;
-  void set_key(uint64_t value);
-  private:
-  uint64_t _internal_key() const;
-  void _internal_set_key(uint64_t value);
-  public:
-
-  // uint64 table_id = 2;
-  void clear_table_id();
-  uint64_t table_id() const;
-  void set_table_id(uint64_t value);
-  private:
-  uint64_t _internal_table_id() const;
-  void _internal_set_table_id(uint64_t value);
-  public:
-
-  // uint64 size = 3;
-  void clear_size();
-  uint64_t size() const;
-  void set_size(uint64_t value);
-  private:
-  uint64_t _internal_size() const;
-  void _internal_set_size(uint64_t value);
-  public:
-
-  // uint64 access_type = 5;
-  void clear_access_type();
-  uint64_t access_type() const;
-  void set_access_type(uint64_t value);
-  private:
-  uint64_t _internal_access_type() const;
-  void _internal_set_access_type(uint64_t value);
-  public:
-
-  // uint64 version = 6;
-  void clear_version();
-  uint64_t version() const;
-  void set_version(uint64_t value);
-  private:
-  uint64_t _internal_version() const;
-  void _internal_set_version(uint64_t value);
-  public:
-
-  // uint64 index_id = 7;
-  void clear_index_id();
-  uint64_t index_id() const;
-  void set_index_id(uint64_t value);
-  private:
-  uint64_t _internal_index_id() const;
-  void _internal_set_index_id(uint64_t value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:sundial_rpc.SundialResponse.TupleData)
- private:
-  class _Internal;
-
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
-  uint64_t key_;
-  uint64_t table_id_;
-  uint64_t size_;
-  uint64_t access_type_;
-  uint64_t version_;
-  uint64_t index_id_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_sundial_2eproto;
-};
-// -------------------------------------------------------------------
-
-class SundialResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sundial_rpc.SundialResponse) */ {
- public:
-  inline SundialResponse() : SundialResponse(nullptr) {}
-  ~SundialResponse() override;
-  explicit constexpr SundialResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
-
-  SundialResponse(const SundialResponse& from);
-  SundialResponse(SundialResponse&& from) noexcept
-    : SundialResponse() {
-    *this = ::std::move(from);
-  }
-
-  inline SundialResponse& operator=(const SundialResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline SundialResponse& operator=(SundialResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (GetOwningArena() == from.GetOwningArena()
-  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
-        && GetOwningArena() != nullptr
-  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
-    ) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const SundialResponse& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const SundialResponse* internal_default_instance() {
-    return reinterpret_cast<const SundialResponse*>(
-               &_SundialResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    5;
-
-  friend void swap(SundialResponse& a, SundialResponse& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(SundialResponse* other) {
-    if (other == this) return;
-  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() != nullptr &&
-        GetOwningArena() == other->GetOwningArena()) {
-   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() == other->GetOwningArena()) {
-  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
-      InternalSwap(other);
-    } else {
-      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(SundialResponse* other) {
-    if (other == this) return;
-    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  SundialResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SundialResponse>(arena);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const SundialResponse& from);
-  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const SundialResponse& from);
-  private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
-  public:
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  uint8_t* _InternalSerialize(
-      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(SundialResponse* other);
-
-  private:
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "sundial_rpc.SundialResponse";
-  }
-  protected:
-  explicit SundialResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                       bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  public:
-
-  static const ClassData _class_data_;
-  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-
-  // nested types ----------------------------------------------------
-
-  typedef SundialResponse_TupleData TupleData;
-
-  typedef SundialResponse_RequestType RequestType;
-  static constexpr RequestType DummyReply =
-    SundialResponse_RequestType_DummyReply;
-  static constexpr RequestType READ_REQ =
-    SundialResponse_RequestType_READ_REQ;
-  static constexpr RequestType PREPARE_REQ =
-    SundialResponse_RequestType_PREPARE_REQ;
-  static constexpr RequestType COMMIT_REQ =
-    SundialResponse_RequestType_COMMIT_REQ;
-  static constexpr RequestType ABORT_REQ =
-    SundialResponse_RequestType_ABORT_REQ;
-  static constexpr RequestType SYS_REQ =
-    SundialResponse_RequestType_SYS_REQ;
-  static constexpr RequestType TERMINATE_REQ =
-    SundialResponse_RequestType_TERMINATE_REQ;
-  static constexpr RequestType PAXOS_LOG_ACK =
-    SundialResponse_RequestType_PAXOS_LOG_ACK;
-  static constexpr RequestType PAXOS_FORWARD_ACK =
-    SundialResponse_RequestType_PAXOS_FORWARD_ACK;
-  static constexpr RequestType NUM_REQ_TYPES =
-    SundialResponse_RequestType_NUM_REQ_TYPES;
-  static inline bool RequestType_IsValid(int value) {
-    return SundialResponse_RequestType_IsValid(value);
-  }
-  static constexpr RequestType RequestType_MIN =
-    SundialResponse_RequestType_RequestType_MIN;
-  static constexpr RequestType RequestType_MAX =
-    SundialResponse_RequestType_RequestType_MAX;
-  static constexpr int RequestType_ARRAYSIZE =
-    SundialResponse_RequestType_RequestType_ARRAYSIZE;
-  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
-  RequestType_descriptor() {
-    return SundialResponse_RequestType_descriptor();
-  }
-  template<typename T>
-  static inline const std::string& RequestType_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, RequestType>::value ||
-      ::std::is_integral<T>::value,
-      "Incorrect type passed to function RequestType_Name.");
-    return SundialResponse_RequestType_Name(enum_t_value);
-  }
-  static inline bool RequestType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
-      RequestType* value) {
-    return SundialResponse_RequestType_Parse(name, value);
-  }
-
-  typedef SundialResponse_ResponseType ResponseType;
-  static constexpr ResponseType RESP_OK =
-    SundialResponse_ResponseType_RESP_OK;
-  static constexpr ResponseType RESP_ABORT =
-    SundialResponse_ResponseType_RESP_ABORT;
-  static constexpr ResponseType RESP_FAIL =
-    SundialResponse_ResponseType_RESP_FAIL;
-  static constexpr ResponseType PREPARED_OK =
-    SundialResponse_ResponseType_PREPARED_OK;
-  static constexpr ResponseType PREPARED_OK_RO =
-    SundialResponse_ResponseType_PREPARED_OK_RO;
-  static constexpr ResponseType PREPARED_ABORT =
-    SundialResponse_ResponseType_PREPARED_ABORT;
-  static constexpr ResponseType ACK =
-    SundialResponse_ResponseType_ACK;
-  static constexpr ResponseType SYS_RESP =
-    SundialResponse_ResponseType_SYS_RESP;
-  static constexpr ResponseType NUM_RESP_TYPES =
-    SundialResponse_ResponseType_NUM_RESP_TYPES;
-  static inline bool ResponseType_IsValid(int value) {
-    return SundialResponse_ResponseType_IsValid(value);
-  }
-  static constexpr ResponseType ResponseType_MIN =
-    SundialResponse_ResponseType_ResponseType_MIN;
-  static constexpr ResponseType ResponseType_MAX =
-    SundialResponse_ResponseType_ResponseType_MAX;
-  static constexpr int ResponseType_ARRAYSIZE =
-    SundialResponse_ResponseType_ResponseType_ARRAYSIZE;
-  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
-  ResponseType_descriptor() {
-    return SundialResponse_ResponseType_descriptor();
-  }
-  template<typename T>
-  static inline const std::string& ResponseType_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, ResponseType>::value ||
-      ::std::is_integral<T>::value,
-      "Incorrect type passed to function ResponseType_Name.");
-    return SundialResponse_ResponseType_Name(enum_t_value);
-  }
-  static inline bool ResponseType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
-      ResponseType* value) {
-    return SundialResponse_ResponseType_Parse(name, value);
-  }
-
-  typedef SundialResponse_NodeType NodeType;
-  static constexpr NodeType COORDINATOR =
-    SundialResponse_NodeType_COORDINATOR;
-  static constexpr NodeType PARTICIPANT =
-    SundialResponse_NodeType_PARTICIPANT;
-  static constexpr NodeType STORAGE =
-    SundialResponse_NodeType_STORAGE;
-  static inline bool NodeType_IsValid(int value) {
-    return SundialResponse_NodeType_IsValid(value);
-  }
-  static constexpr NodeType NodeType_MIN =
-    SundialResponse_NodeType_NodeType_MIN;
-  static constexpr NodeType NodeType_MAX =
-    SundialResponse_NodeType_NodeType_MAX;
-  static constexpr int NodeType_ARRAYSIZE =
-    SundialResponse_NodeType_NodeType_ARRAYSIZE;
-  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
-  NodeType_descriptor() {
-    return SundialResponse_NodeType_descriptor();
-  }
-  template<typename T>
-  static inline const std::string& NodeType_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, NodeType>::value ||
-      ::std::is_integral<T>::value,
-      "Incorrect type passed to function NodeType_Name.");
-    return SundialResponse_NodeType_Name(enum_t_value);
-  }
-  static inline bool NodeType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
-      NodeType* value) {
-    return SundialResponse_NodeType_Parse(name, value);
-  }
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kTupleDataFieldNumber = 3,
-    kTxnIdFieldNumber = 1,
-    kResponseTypeFieldNumber = 2,
-    kRequestTypeFieldNumber = 5,
-    kNodeIdFieldNumber = 4,
-    kThdIdFieldNumber = 6,
-    kNodeTypeFieldNumber = 7,
-  };
-  // repeated .sundial_rpc.SundialResponse.TupleData tuple_data = 3;
-  int tuple_data_size() const;
-  private:
-  int _internal_tuple_data_size() const;
-  public:
-  void clear_tuple_data();
-  ::sundial_rpc::SundialResponse_TupleData* mutable_tuple_data(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sundial_rpc::SundialResponse_TupleData >*
-      mutable_tuple_data();
-  private:
-  const ::sundial_rpc::SundialResponse_TupleData& _internal_tuple_data(int index) const;
-  ::sundial_rpc::SundialResponse_TupleData* _internal_add_tuple_data();
-  public:
-  const ::sundial_rpc::SundialResponse_TupleData& tuple_data(int index) const;
-  ::sundial_rpc::SundialResponse_TupleData* add_tuple_data();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sundial_rpc::SundialResponse_TupleData >&
-      tuple_data() const;
-
-  // uint64 txn_id = 1;
-  void clear_txn_id();
-  uint64_t txn_id() const;
-  void set_txn_id(uint64_t value);
-  private:
-  uint64_t _internal_txn_id() const;
-  void _internal_set_txn_id(uint64_t value);
-  public:
-
-  // .sundial_rpc.SundialResponse.ResponseType response_type = 2;
-  void clear_response_type();
-  ::sundial_rpc::SundialResponse_ResponseType response_type() const;
-  void set_response_type(::sundial_rpc::SundialResponse_ResponseType value);
-  private:
-  ::sundial_rpc::SundialResponse_ResponseType _internal_response_type() const;
-  void _internal_set_response_type(::sundial_rpc::SundialResponse_ResponseType value);
-  public:
-
-  // .sundial_rpc.SundialResponse.RequestType request_type = 5;
-  void clear_request_type();
-  ::sundial_rpc::SundialResponse_RequestType request_type() const;
-  void set_request_type(::sundial_rpc::SundialResponse_RequestType value);
-  private:
-  ::sundial_rpc::SundialResponse_RequestType _internal_request_type() const;
-  void _internal_set_request_type(::sundial_rpc::SundialResponse_RequestType value);
-  public:
-
-  // uint64 node_id = 4;
-  void clear_node_id();
-  uint64_t node_id() const;
-  void set_node_id(uint64_t value);
-  private:
-  uint64_t _internal_node_id() const;
-  void _internal_set_node_id(uint64_t value);
-  public:
-
-  // uint32 thd_id = 6;
-  void clear_thd_id();
-  uint32_t thd_id() const;
-  void set_thd_id(uint32_t value);
-  private:
-  uint32_t _internal_thd_id() const;
-  void _internal_set_thd_id(uint32_t value);
-  public:
-
-  // .sundial_rpc.SundialResponse.NodeType node_type = 7;
-  void clear_node_type();
-  ::sundial_rpc::SundialResponse_NodeType node_type() const;
-  void set_node_type(::sundial_rpc::SundialResponse_NodeType value);
-  private:
-  ::sundial_rpc::SundialResponse_NodeType _internal_node_type() const;
-  void _internal_set_node_type(::sundial_rpc::SundialResponse_NodeType value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:sundial_rpc.SundialResponse)
- private:
-  class _Internal;
-
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sundial_rpc::SundialResponse_TupleData > tuple_data_;
-  uint64_t txn_id_;
-  int response_type_;
-  int request_type_;
-  uint64_t node_id_;
-  uint32_t thd_id_;
-  int node_type_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_sundial_2eproto;
-};
-// ===================================================================
-
-
-// ===================================================================
-
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// SundialRequest_ReadRequest
-
-// uint64 key = 1;
-inline void SundialRequest_ReadRequest::clear_key() {
-  key_ = uint64_t{0u};
-}
-inline uint64_t SundialRequest_ReadRequest::_internal_key() const {
-  return key_;
-}
-inline uint64_t SundialRequest_ReadRequest::key() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialRequest.ReadRequest.key)
-  return _internal_key();
-}
-inline void SundialRequest_ReadRequest::_internal_set_key(uint64_t value) {
-  
-  key_ = value;
-}
-inline void SundialRequest_ReadRequest::set_key(uint64_t value) {
-  _internal_set_key(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialRequest.ReadRequest.key)
-}
-
-// uint64 index_id = 2;
-inline void SundialRequest_ReadRequest::clear_index_id() {
-  index_id_ = uint64_t{0u};
-}
-inline uint64_t SundialRequest_ReadRequest::_internal_index_id() const {
-  return index_id_;
-}
-inline uint64_t SundialRequest_ReadRequest::index_id() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialRequest.ReadRequest.index_id)
-  return _internal_index_id();
-}
-inline void SundialRequest_ReadRequest::_internal_set_index_id(uint64_t value) {
-  
-  index_id_ = value;
-}
-inline void SundialRequest_ReadRequest::set_index_id(uint64_t value) {
-  _internal_set_index_id(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialRequest.ReadRequest.index_id)
-}
-
-// uint64 access_type = 3;
-inline void SundialRequest_ReadRequest::clear_access_type() {
-  access_type_ = uint64_t{0u};
-}
-inline uint64_t SundialRequest_ReadRequest::_internal_access_type() const {
-  return access_type_;
-}
-inline uint64_t SundialRequest_ReadRequest::access_type() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialRequest.ReadRequest.access_type)
-  return _internal_access_type();
-}
-inline void SundialRequest_ReadRequest::_internal_set_access_type(uint64_t value) {
-  
-  access_type_ = value;
-}
-inline void SundialRequest_ReadRequest::set_access_type(uint64_t value) {
-  _internal_set_access_type(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialRequest.ReadRequest.access_type)
-}
-
-// -------------------------------------------------------------------
-
-// SundialRequest_TupleData
-
-// uint64 key = 1;
-inline void SundialRequest_TupleData::clear_key() {
-  key_ = uint64_t{0u};
-}
-inline uint64_t SundialRequest_TupleData::_internal_key() const {
-  return key_;
-}
-inline uint64_t SundialRequest_TupleData::key() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialRequest.TupleData.key)
-  return _internal_key();
-}
-inline void SundialRequest_TupleData::_internal_set_key(uint64_t value) {
-  
-  key_ = value;
-}
-inline void SundialRequest_TupleData::set_key(uint64_t value) {
-  _internal_set_key(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialRequest.TupleData.key)
-}
-
-// uint64 table_id = 2;
-inline void SundialRequest_TupleData::clear_table_id() {
-  table_id_ = uint64_t{0u};
-}
-inline uint64_t SundialRequest_TupleData::_internal_table_id() const {
-  return table_id_;
-}
-inline uint64_t SundialRequest_TupleData::table_id() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialRequest.TupleData.table_id)
-  return _internal_table_id();
-}
-inline void SundialRequest_TupleData::_internal_set_table_id(uint64_t value) {
-  
-  table_id_ = value;
-}
-inline void SundialRequest_TupleData::set_table_id(uint64_t value) {
-  _internal_set_table_id(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialRequest.TupleData.table_id)
-}
-
-// uint64 size = 3;
-inline void SundialRequest_TupleData::clear_size() {
-  size_ = uint64_t{0u};
-}
-inline uint64_t SundialRequest_TupleData::_internal_size() const {
-  return size_;
-}
-inline uint64_t SundialRequest_TupleData::size() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialRequest.TupleData.size)
-  return _internal_size();
-}
-inline void SundialRequest_TupleData::_internal_set_size(uint64_t value) {
-  
-  size_ = value;
-}
-inline void SundialRequest_TupleData::set_size(uint64_t value) {
-  _internal_set_size(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialRequest.TupleData.size)
-}
-
-// bytes data = 4;
-inline void SundialRequest_TupleData::clear_data() {
-  data_.ClearToEmpty();
-}
-inline const std::string& SundialRequest_TupleData::data() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialRequest.TupleData.data)
-  return _internal_data();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void SundialRequest_TupleData::set_data(ArgT0&& arg0, ArgT... args) {
- 
- data_.SetBytes(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialRequest.TupleData.data)
-}
-inline std::string* SundialRequest_TupleData::mutable_data() {
-  std::string* _s = _internal_mutable_data();
-  // @@protoc_insertion_point(field_mutable:sundial_rpc.SundialRequest.TupleData.data)
-  return _s;
-}
-inline const std::string& SundialRequest_TupleData::_internal_data() const {
-  return data_.Get();
-}
-inline void SundialRequest_TupleData::_internal_set_data(const std::string& value) {
-  
-  data_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
-}
-inline std::string* SundialRequest_TupleData::_internal_mutable_data() {
-  
-  return data_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
-}
-inline std::string* SundialRequest_TupleData::release_data() {
-  // @@protoc_insertion_point(field_release:sundial_rpc.SundialRequest.TupleData.data)
-  return data_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
-}
-inline void SundialRequest_TupleData::set_allocated_data(std::string* data) {
-  if (data != nullptr) {
-    
-  } else {
-    
-  }
-  data_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), data,
-      GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (data_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:sundial_rpc.SundialRequest.TupleData.data)
-}
-
-// uint64 access_type = 5;
-inline void SundialRequest_TupleData::clear_access_type() {
-  access_type_ = uint64_t{0u};
-}
-inline uint64_t SundialRequest_TupleData::_internal_access_type() const {
-  return access_type_;
-}
-inline uint64_t SundialRequest_TupleData::access_type() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialRequest.TupleData.access_type)
-  return _internal_access_type();
-}
-inline void SundialRequest_TupleData::_internal_set_access_type(uint64_t value) {
-  
-  access_type_ = value;
-}
-inline void SundialRequest_TupleData::set_access_type(uint64_t value) {
-  _internal_set_access_type(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialRequest.TupleData.access_type)
-}
-
-// uint64 version = 6;
-inline void SundialRequest_TupleData::clear_version() {
-  version_ = uint64_t{0u};
-}
-inline uint64_t SundialRequest_TupleData::_internal_version() const {
-  return version_;
-}
-inline uint64_t SundialRequest_TupleData::version() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialRequest.TupleData.version)
-  return _internal_version();
-}
-inline void SundialRequest_TupleData::_internal_set_version(uint64_t value) {
-  
-  version_ = value;
-}
-inline void SundialRequest_TupleData::set_version(uint64_t value) {
-  _internal_set_version(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialRequest.TupleData.version)
-}
-
-// uint64 index_id = 7;
-inline void SundialRequest_TupleData::clear_index_id() {
-  index_id_ = uint64_t{0u};
-}
-inline uint64_t SundialRequest_TupleData::_internal_index_id() const {
-  return index_id_;
-}
-inline uint64_t SundialRequest_TupleData::index_id() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialRequest.TupleData.index_id)
-  return _internal_index_id();
-}
-inline void SundialRequest_TupleData::_internal_set_index_id(uint64_t value) {
-  
-  index_id_ = value;
-}
-inline void SundialRequest_TupleData::set_index_id(uint64_t value) {
-  _internal_set_index_id(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialRequest.TupleData.index_id)
-}
-
-// -------------------------------------------------------------------
-
-// SundialRequest_NodeData
-
-// uint64 nid = 1;
-inline void SundialRequest_NodeData::clear_nid() {
-  nid_ = uint64_t{0u};
-}
-inline uint64_t SundialRequest_NodeData::_internal_nid() const {
-  return nid_;
-}
-inline uint64_t SundialRequest_NodeData::nid() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialRequest.NodeData.nid)
-  return _internal_nid();
-}
-inline void SundialRequest_NodeData::_internal_set_nid(uint64_t value) {
-  
-  nid_ = value;
-}
-inline void SundialRequest_NodeData::set_nid(uint64_t value) {
-  _internal_set_nid(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialRequest.NodeData.nid)
-}
-
-// -------------------------------------------------------------------
-
-// SundialRequest
-
-// uint64 txn_id = 1;
-inline void SundialRequest::clear_txn_id() {
-  txn_id_ = uint64_t{0u};
-}
-inline uint64_t SundialRequest::_internal_txn_id() const {
-  return txn_id_;
-}
-inline uint64_t SundialRequest::txn_id() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialRequest.txn_id)
-  return _internal_txn_id();
-}
-inline void SundialRequest::_internal_set_txn_id(uint64_t value) {
-  
-  txn_id_ = value;
-}
-inline void SundialRequest::set_txn_id(uint64_t value) {
-  _internal_set_txn_id(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialRequest.txn_id)
-}
-
-// .sundial_rpc.SundialRequest.RequestType request_type = 2;
-inline void SundialRequest::clear_request_type() {
-  request_type_ = 0;
-}
-inline ::sundial_rpc::SundialRequest_RequestType SundialRequest::_internal_request_type() const {
-  return static_cast< ::sundial_rpc::SundialRequest_RequestType >(request_type_);
-}
-inline ::sundial_rpc::SundialRequest_RequestType SundialRequest::request_type() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialRequest.request_type)
-  return _internal_request_type();
-}
-inline void SundialRequest::_internal_set_request_type(::sundial_rpc::SundialRequest_RequestType value) {
-  
-  request_type_ = value;
-}
-inline void SundialRequest::set_request_type(::sundial_rpc::SundialRequest_RequestType value) {
-  _internal_set_request_type(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialRequest.request_type)
-}
-
-// repeated .sundial_rpc.SundialRequest.ReadRequest read_requests = 3;
-inline int SundialRequest::_internal_read_requests_size() const {
-  return read_requests_.size();
-}
-inline int SundialRequest::read_requests_size() const {
-  return _internal_read_requests_size();
-}
-inline void SundialRequest::clear_read_requests() {
-  read_requests_.Clear();
-}
-inline ::sundial_rpc::SundialRequest_ReadRequest* SundialRequest::mutable_read_requests(int index) {
-  // @@protoc_insertion_point(field_mutable:sundial_rpc.SundialRequest.read_requests)
-  return read_requests_.Mutable(index);
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sundial_rpc::SundialRequest_ReadRequest >*
-SundialRequest::mutable_read_requests() {
-  // @@protoc_insertion_point(field_mutable_list:sundial_rpc.SundialRequest.read_requests)
-  return &read_requests_;
-}
-inline const ::sundial_rpc::SundialRequest_ReadRequest& SundialRequest::_internal_read_requests(int index) const {
-  return read_requests_.Get(index);
-}
-inline const ::sundial_rpc::SundialRequest_ReadRequest& SundialRequest::read_requests(int index) const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialRequest.read_requests)
-  return _internal_read_requests(index);
-}
-inline ::sundial_rpc::SundialRequest_ReadRequest* SundialRequest::_internal_add_read_requests() {
-  return read_requests_.Add();
-}
-inline ::sundial_rpc::SundialRequest_ReadRequest* SundialRequest::add_read_requests() {
-  ::sundial_rpc::SundialRequest_ReadRequest* _add = _internal_add_read_requests();
-  // @@protoc_insertion_point(field_add:sundial_rpc.SundialRequest.read_requests)
-  return _add;
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sundial_rpc::SundialRequest_ReadRequest >&
-SundialRequest::read_requests() const {
-  // @@protoc_insertion_point(field_list:sundial_rpc.SundialRequest.read_requests)
-  return read_requests_;
-}
-
-// repeated .sundial_rpc.SundialRequest.TupleData tuple_data = 4;
-inline int SundialRequest::_internal_tuple_data_size() const {
-  return tuple_data_.size();
-}
-inline int SundialRequest::tuple_data_size() const {
-  return _internal_tuple_data_size();
-}
-inline void SundialRequest::clear_tuple_data() {
-  tuple_data_.Clear();
-}
-inline ::sundial_rpc::SundialRequest_TupleData* SundialRequest::mutable_tuple_data(int index) {
-  // @@protoc_insertion_point(field_mutable:sundial_rpc.SundialRequest.tuple_data)
-  return tuple_data_.Mutable(index);
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sundial_rpc::SundialRequest_TupleData >*
-SundialRequest::mutable_tuple_data() {
-  // @@protoc_insertion_point(field_mutable_list:sundial_rpc.SundialRequest.tuple_data)
-  return &tuple_data_;
-}
-inline const ::sundial_rpc::SundialRequest_TupleData& SundialRequest::_internal_tuple_data(int index) const {
-  return tuple_data_.Get(index);
-}
-inline const ::sundial_rpc::SundialRequest_TupleData& SundialRequest::tuple_data(int index) const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialRequest.tuple_data)
-  return _internal_tuple_data(index);
-}
-inline ::sundial_rpc::SundialRequest_TupleData* SundialRequest::_internal_add_tuple_data() {
-  return tuple_data_.Add();
-}
-inline ::sundial_rpc::SundialRequest_TupleData* SundialRequest::add_tuple_data() {
-  ::sundial_rpc::SundialRequest_TupleData* _add = _internal_add_tuple_data();
-  // @@protoc_insertion_point(field_add:sundial_rpc.SundialRequest.tuple_data)
-  return _add;
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sundial_rpc::SundialRequest_TupleData >&
-SundialRequest::tuple_data() const {
-  // @@protoc_insertion_point(field_list:sundial_rpc.SundialRequest.tuple_data)
-  return tuple_data_;
-}
-
-// uint64 log_data_size = 5;
-inline void SundialRequest::clear_log_data_size() {
-  log_data_size_ = uint64_t{0u};
-}
-inline uint64_t SundialRequest::_internal_log_data_size() const {
-  return log_data_size_;
-}
-inline uint64_t SundialRequest::log_data_size() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialRequest.log_data_size)
-  return _internal_log_data_size();
-}
-inline void SundialRequest::_internal_set_log_data_size(uint64_t value) {
-  
-  log_data_size_ = value;
-}
-inline void SundialRequest::set_log_data_size(uint64_t value) {
-  _internal_set_log_data_size(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialRequest.log_data_size)
-}
-
-// uint64 node_id = 6;
-inline void SundialRequest::clear_node_id() {
-  node_id_ = uint64_t{0u};
-}
-inline uint64_t SundialRequest::_internal_node_id() const {
-  return node_id_;
-}
-inline uint64_t SundialRequest::node_id() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialRequest.node_id)
-  return _internal_node_id();
-}
-inline void SundialRequest::_internal_set_node_id(uint64_t value) {
-  
-  node_id_ = value;
-}
-inline void SundialRequest::set_node_id(uint64_t value) {
-  _internal_set_node_id(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialRequest.node_id)
-}
-
-// repeated .sundial_rpc.SundialRequest.NodeData nodes = 7;
-inline int SundialRequest::_internal_nodes_size() const {
-  return nodes_.size();
-}
-inline int SundialRequest::nodes_size() const {
-  return _internal_nodes_size();
-}
-inline void SundialRequest::clear_nodes() {
-  nodes_.Clear();
-}
-inline ::sundial_rpc::SundialRequest_NodeData* SundialRequest::mutable_nodes(int index) {
-  // @@protoc_insertion_point(field_mutable:sundial_rpc.SundialRequest.nodes)
-  return nodes_.Mutable(index);
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sundial_rpc::SundialRequest_NodeData >*
-SundialRequest::mutable_nodes() {
-  // @@protoc_insertion_point(field_mutable_list:sundial_rpc.SundialRequest.nodes)
-  return &nodes_;
-}
-inline const ::sundial_rpc::SundialRequest_NodeData& SundialRequest::_internal_nodes(int index) const {
-  return nodes_.Get(index);
-}
-inline const ::sundial_rpc::SundialRequest_NodeData& SundialRequest::nodes(int index) const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialRequest.nodes)
-  return _internal_nodes(index);
-}
-inline ::sundial_rpc::SundialRequest_NodeData* SundialRequest::_internal_add_nodes() {
-  return nodes_.Add();
-}
-inline ::sundial_rpc::SundialRequest_NodeData* SundialRequest::add_nodes() {
-  ::sundial_rpc::SundialRequest_NodeData* _add = _internal_add_nodes();
-  // @@protoc_insertion_point(field_add:sundial_rpc.SundialRequest.nodes)
-  return _add;
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sundial_rpc::SundialRequest_NodeData >&
-SundialRequest::nodes() const {
-  // @@protoc_insertion_point(field_list:sundial_rpc.SundialRequest.nodes)
-  return nodes_;
-}
-
-// uint64 request_time = 8;
-inline void SundialRequest::clear_request_time() {
-  request_time_ = uint64_t{0u};
-}
-inline uint64_t SundialRequest::_internal_request_time() const {
-  return request_time_;
-}
-inline uint64_t SundialRequest::request_time() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialRequest.request_time)
-  return _internal_request_time();
-}
-inline void SundialRequest::_internal_set_request_time(uint64_t value) {
-  
-  request_time_ = value;
-}
-inline void SundialRequest::set_request_time(uint64_t value) {
-  _internal_set_request_time(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialRequest.request_time)
-}
-
-// uint64 thread_id = 9;
-inline void SundialRequest::clear_thread_id() {
-  thread_id_ = uint64_t{0u};
-}
-inline uint64_t SundialRequest::_internal_thread_id() const {
-  return thread_id_;
-}
-inline uint64_t SundialRequest::thread_id() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialRequest.thread_id)
-  return _internal_thread_id();
-}
-inline void SundialRequest::_internal_set_thread_id(uint64_t value) {
-  
-  thread_id_ = value;
-}
-inline void SundialRequest::set_thread_id(uint64_t value) {
-  _internal_set_thread_id(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialRequest.thread_id)
-}
-
-// .sundial_rpc.SundialRequest.NodeType node_type = 10;
-inline void SundialRequest::clear_node_type() {
-  node_type_ = 0;
-}
-inline ::sundial_rpc::SundialRequest_NodeType SundialRequest::_internal_node_type() const {
-  return static_cast< ::sundial_rpc::SundialRequest_NodeType >(node_type_);
-}
-inline ::sundial_rpc::SundialRequest_NodeType SundialRequest::node_type() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialRequest.node_type)
-  return _internal_node_type();
-}
-inline void SundialRequest::_internal_set_node_type(::sundial_rpc::SundialRequest_NodeType value) {
-  
-  node_type_ = value;
-}
-inline void SundialRequest::set_node_type(::sundial_rpc::SundialRequest_NodeType value) {
-  _internal_set_node_type(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialRequest.node_type)
-}
-
-// uint64 coord_id = 11;
-inline void SundialRequest::clear_coord_id() {
-  coord_id_ = uint64_t{0u};
-}
-inline uint64_t SundialRequest::_internal_coord_id() const {
-  return coord_id_;
-}
-inline uint64_t SundialRequest::coord_id() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialRequest.coord_id)
-  return _internal_coord_id();
-}
-inline void SundialRequest::_internal_set_coord_id(uint64_t value) {
-  
-  coord_id_ = value;
-}
-inline void SundialRequest::set_coord_id(uint64_t value) {
-  _internal_set_coord_id(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialRequest.coord_id)
-}
-
-// int32 txn_state = 12;
-inline void SundialRequest::clear_txn_state() {
-  txn_state_ = 0;
-}
-inline int32_t SundialRequest::_internal_txn_state() const {
-  return txn_state_;
-}
-inline int32_t SundialRequest::txn_state() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialRequest.txn_state)
-  return _internal_txn_state();
-}
-inline void SundialRequest::_internal_set_txn_state(int32_t value) {
-  
-  txn_state_ = value;
-}
-inline void SundialRequest::set_txn_state(int32_t value) {
-  _internal_set_txn_state(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialRequest.txn_state)
-}
-
-// uint64 semaphore = 13;
-inline void SundialRequest::clear_semaphore() {
-  semaphore_ = uint64_t{0u};
-}
-inline uint64_t SundialRequest::_internal_semaphore() const {
-  return semaphore_;
-}
-inline uint64_t SundialRequest::semaphore() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialRequest.semaphore)
-  return _internal_semaphore();
-}
-inline void SundialRequest::_internal_set_semaphore(uint64_t value) {
-  
-  semaphore_ = value;
-}
-inline void SundialRequest::set_semaphore(uint64_t value) {
-  _internal_set_semaphore(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialRequest.semaphore)
-}
-
-// uint32 thd_id = 14;
-inline void SundialRequest::clear_thd_id() {
-  thd_id_ = 0u;
-}
-inline uint32_t SundialRequest::_internal_thd_id() const {
-  return thd_id_;
-}
-inline uint32_t SundialRequest::thd_id() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialRequest.thd_id)
-  return _internal_thd_id();
-}
-inline void SundialRequest::_internal_set_thd_id(uint32_t value) {
-  
-  thd_id_ = value;
-}
-inline void SundialRequest::set_thd_id(uint32_t value) {
-  _internal_set_thd_id(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialRequest.thd_id)
-}
-
-// .sundial_rpc.SundialRequest.ResponseType forward_msg = 15;
-inline void SundialRequest::clear_forward_msg() {
-  forward_msg_ = 0;
-}
-inline ::sundial_rpc::SundialRequest_ResponseType SundialRequest::_internal_forward_msg() const {
-  return static_cast< ::sundial_rpc::SundialRequest_ResponseType >(forward_msg_);
-}
-inline ::sundial_rpc::SundialRequest_ResponseType SundialRequest::forward_msg() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialRequest.forward_msg)
-  return _internal_forward_msg();
-}
-inline void SundialRequest::_internal_set_forward_msg(::sundial_rpc::SundialRequest_ResponseType value) {
-  
-  forward_msg_ = value;
-}
-inline void SundialRequest::set_forward_msg(::sundial_rpc::SundialRequest_ResponseType value) {
-  _internal_set_forward_msg(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialRequest.forward_msg)
-}
-
-// uint64 receiver_id = 16;
-inline void SundialRequest::clear_receiver_id() {
-  receiver_id_ = uint64_t{0u};
-}
-inline uint64_t SundialRequest::_internal_receiver_id() const {
-  return receiver_id_;
-}
-inline uint64_t SundialRequest::receiver_id() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialRequest.receiver_id)
-  return _internal_receiver_id();
-}
-inline void SundialRequest::_internal_set_receiver_id(uint64_t value) {
-  
-  receiver_id_ = value;
-}
-inline void SundialRequest::set_receiver_id(uint64_t value) {
-  _internal_set_receiver_id(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialRequest.receiver_id)
-}
-
-// -------------------------------------------------------------------
-
-// SundialResponse_TupleData
-
-// uint64 key = 1;
-inline void SundialResponse_TupleData::clear_key() {
-  key_ = uint64_t{0u};
-}
-inline uint64_t SundialResponse_TupleData::_internal_key() const {
-  return key_;
-}
-inline uint64_t SundialResponse_TupleData::key() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialResponse.TupleData.key)
-  return _internal_key();
-}
-inline void SundialResponse_TupleData::_internal_set_key(uint64_t value) {
-  
-  key_ = value;
-}
-inline void SundialResponse_TupleData::set_key(uint64_t value) {
-  _internal_set_key(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialResponse.TupleData.key)
-}
-
-// uint64 table_id = 2;
-inline void SundialResponse_TupleData::clear_table_id() {
-  table_id_ = uint64_t{0u};
-}
-inline uint64_t SundialResponse_TupleData::_internal_table_id() const {
-  return table_id_;
-}
-inline uint64_t SundialResponse_TupleData::table_id() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialResponse.TupleData.table_id)
-  return _internal_table_id();
-}
-inline void SundialResponse_TupleData::_internal_set_table_id(uint64_t value) {
-  
-  table_id_ = value;
-}
-inline void SundialResponse_TupleData::set_table_id(uint64_t value) {
-  _internal_set_table_id(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialResponse.TupleData.table_id)
-}
-
-// uint64 size = 3;
-inline void SundialResponse_TupleData::clear_size() {
-  size_ = uint64_t{0u};
-}
-inline uint64_t SundialResponse_TupleData::_internal_size() const {
-  return size_;
-}
-inline uint64_t SundialResponse_TupleData::size() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialResponse.TupleData.size)
-  return _internal_size();
-}
-inline void SundialResponse_TupleData::_internal_set_size(uint64_t value) {
-  
-  size_ = value;
-}
-inline void SundialResponse_TupleData::set_size(uint64_t value) {
-  _internal_set_size(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialResponse.TupleData.size)
-}
-
-// bytes data = 4;
-inline void SundialResponse_TupleData::clear_data() {
-  data_.ClearToEmpty();
-}
-inline const std::string& SundialResponse_TupleData::data() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialResponse.TupleData.data)
-  return _internal_data();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void SundialResponse_TupleData::set_data(ArgT0&& arg0, ArgT... args) {
- 
- data_.SetBytes(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialResponse.TupleData.data)
-}
-inline std::string* SundialResponse_TupleData::mutable_data() {
-  std::string* _s = _internal_mutable_data();
-  // @@protoc_insertion_point(field_mutable:sundial_rpc.SundialResponse.TupleData.data)
-  return _s;
-}
-inline const std::string& SundialResponse_TupleData::_internal_data() const {
-  return data_.Get();
-}
-inline void SundialResponse_TupleData::_internal_set_data(const std::string& value) {
-  
-  data_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
-}
-inline std::string* SundialResponse_TupleData::_internal_mutable_data() {
-  
-  return data_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
-}
-inline std::string* SundialResponse_TupleData::release_data() {
-  // @@protoc_insertion_point(field_release:sundial_rpc.SundialResponse.TupleData.data)
-  return data_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
-}
-inline void SundialResponse_TupleData::set_allocated_data(std::string* data) {
-  if (data != nullptr) {
-    
-  } else {
-    
-  }
-  data_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), data,
-      GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (data_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:sundial_rpc.SundialResponse.TupleData.data)
-}
-
-// uint64 access_type = 5;
-inline void SundialResponse_TupleData::clear_access_type() {
-  access_type_ = uint64_t{0u};
-}
-inline uint64_t SundialResponse_TupleData::_internal_access_type() const {
-  return access_type_;
-}
-inline uint64_t SundialResponse_TupleData::access_type() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialResponse.TupleData.access_type)
-  return _internal_access_type();
-}
-inline void SundialResponse_TupleData::_internal_set_access_type(uint64_t value) {
-  
-  access_type_ = value;
-}
-inline void SundialResponse_TupleData::set_access_type(uint64_t value) {
-  _internal_set_access_type(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialResponse.TupleData.access_type)
-}
-
-// uint64 version = 6;
-inline void SundialResponse_TupleData::clear_version() {
-  version_ = uint64_t{0u};
-}
-inline uint64_t SundialResponse_TupleData::_internal_version() const {
-  return version_;
-}
-inline uint64_t SundialResponse_TupleData::version() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialResponse.TupleData.version)
-  return _internal_version();
-}
-inline void SundialResponse_TupleData::_internal_set_version(uint64_t value) {
-  
-  version_ = value;
-}
-inline void SundialResponse_TupleData::set_version(uint64_t value) {
-  _internal_set_version(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialResponse.TupleData.version)
-}
-
-// uint64 index_id = 7;
-inline void SundialResponse_TupleData::clear_index_id() {
-  index_id_ = uint64_t{0u};
-}
-inline uint64_t SundialResponse_TupleData::_internal_index_id() const {
-  return index_id_;
-}
-inline uint64_t SundialResponse_TupleData::index_id() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialResponse.TupleData.index_id)
-  return _internal_index_id();
-}
-inline void SundialResponse_TupleData::_internal_set_index_id(uint64_t value) {
-  
-  index_id_ = value;
-}
-inline void SundialResponse_TupleData::set_index_id(uint64_t value) {
-  _internal_set_index_id(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialResponse.TupleData.index_id)
-}
-
-// -------------------------------------------------------------------
-
-// SundialResponse
-
-// uint64 txn_id = 1;
-inline void SundialResponse::clear_txn_id() {
-  txn_id_ = uint64_t{0u};
-}
-inline uint64_t SundialResponse::_internal_txn_id() const {
-  return txn_id_;
-}
-inline uint64_t SundialResponse::txn_id() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialResponse.txn_id)
-  return _internal_txn_id();
-}
-inline void SundialResponse::_internal_set_txn_id(uint64_t value) {
-  
-  txn_id_ = value;
-}
-inline void SundialResponse::set_txn_id(uint64_t value) {
-  _internal_set_txn_id(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialResponse.txn_id)
-}
-
-// .sundial_rpc.SundialResponse.ResponseType response_type = 2;
-inline void SundialResponse::clear_response_type() {
-  response_type_ = 0;
-}
-inline ::sundial_rpc::SundialResponse_ResponseType SundialResponse::_internal_response_type() const {
-  return static_cast< ::sundial_rpc::SundialResponse_ResponseType >(response_type_);
-}
-inline ::sundial_rpc::SundialResponse_ResponseType SundialResponse::response_type() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialResponse.response_type)
-  return _internal_response_type();
-}
-inline void SundialResponse::_internal_set_response_type(::sundial_rpc::SundialResponse_ResponseType value) {
-  
-  response_type_ = value;
-}
-inline void SundialResponse::set_response_type(::sundial_rpc::SundialResponse_ResponseType value) {
-  _internal_set_response_type(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialResponse.response_type)
-}
-
-// repeated .sundial_rpc.SundialResponse.TupleData tuple_data = 3;
-inline int SundialResponse::_internal_tuple_data_size() const {
-  return tuple_data_.size();
-}
-inline int SundialResponse::tuple_data_size() const {
-  return _internal_tuple_data_size();
-}
-inline void SundialResponse::clear_tuple_data() {
-  tuple_data_.Clear();
-}
-inline ::sundial_rpc::SundialResponse_TupleData* SundialResponse::mutable_tuple_data(int index) {
-  // @@protoc_insertion_point(field_mutable:sundial_rpc.SundialResponse.tuple_data)
-  return tuple_data_.Mutable(index);
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sundial_rpc::SundialResponse_TupleData >*
-SundialResponse::mutable_tuple_data() {
-  // @@protoc_insertion_point(field_mutable_list:sundial_rpc.SundialResponse.tuple_data)
-  return &tuple_data_;
-}
-inline const ::sundial_rpc::SundialResponse_TupleData& SundialResponse::_internal_tuple_data(int index) const {
-  return tuple_data_.Get(index);
-}
-inline const ::sundial_rpc::SundialResponse_TupleData& SundialResponse::tuple_data(int index) const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialResponse.tuple_data)
-  return _internal_tuple_data(index);
-}
-inline ::sundial_rpc::SundialResponse_TupleData* SundialResponse::_internal_add_tuple_data() {
-  return tuple_data_.Add();
-}
-inline ::sundial_rpc::SundialResponse_TupleData* SundialResponse::add_tuple_data() {
-  ::sundial_rpc::SundialResponse_TupleData* _add = _internal_add_tuple_data();
-  // @@protoc_insertion_point(field_add:sundial_rpc.SundialResponse.tuple_data)
-  return _add;
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sundial_rpc::SundialResponse_TupleData >&
-SundialResponse::tuple_data() const {
-  // @@protoc_insertion_point(field_list:sundial_rpc.SundialResponse.tuple_data)
-  return tuple_data_;
-}
-
-// uint64 node_id = 4;
-inline void SundialResponse::clear_node_id() {
-  node_id_ = uint64_t{0u};
-}
-inline uint64_t SundialResponse::_internal_node_id() const {
-  return node_id_;
-}
-inline uint64_t SundialResponse::node_id() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialResponse.node_id)
-  return _internal_node_id();
-}
-inline void SundialResponse::_internal_set_node_id(uint64_t value) {
-  
-  node_id_ = value;
-}
-inline void SundialResponse::set_node_id(uint64_t value) {
-  _internal_set_node_id(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialResponse.node_id)
-}
-
-// .sundial_rpc.SundialResponse.RequestType request_type = 5;
-inline void SundialResponse::clear_request_type() {
-  request_type_ = 0;
-}
-inline ::sundial_rpc::SundialResponse_RequestType SundialResponse::_internal_request_type() const {
-  return static_cast< ::sundial_rpc::SundialResponse_RequestType >(request_type_);
-}
-inline ::sundial_rpc::SundialResponse_RequestType SundialResponse::request_type() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialResponse.request_type)
-  return _internal_request_type();
-}
-inline void SundialResponse::_internal_set_request_type(::sundial_rpc::SundialResponse_RequestType value) {
-  
-  request_type_ = value;
-}
-inline void SundialResponse::set_request_type(::sundial_rpc::SundialResponse_RequestType value) {
-  _internal_set_request_type(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialResponse.request_type)
-}
-
-// uint32 thd_id = 6;
-inline void SundialResponse::clear_thd_id() {
-  thd_id_ = 0u;
-}
-inline uint32_t SundialResponse::_internal_thd_id() const {
-  return thd_id_;
-}
-inline uint32_t SundialResponse::thd_id() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialResponse.thd_id)
-  return _internal_thd_id();
-}
-inline void SundialResponse::_internal_set_thd_id(uint32_t value) {
-  
-  thd_id_ = value;
-}
-inline void SundialResponse::set_thd_id(uint32_t value) {
-  _internal_set_thd_id(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialResponse.thd_id)
-}
-
-// .sundial_rpc.SundialResponse.NodeType node_type = 7;
-inline void SundialResponse::clear_node_type() {
-  node_type_ = 0;
-}
-inline ::sundial_rpc::SundialResponse_NodeType SundialResponse::_internal_node_type() const {
-  return static_cast< ::sundial_rpc::SundialResponse_NodeType >(node_type_);
-}
-inline ::sundial_rpc::SundialResponse_NodeType SundialResponse::node_type() const {
-  // @@protoc_insertion_point(field_get:sundial_rpc.SundialResponse.node_type)
-  return _internal_node_type();
-}
-inline void SundialResponse::_internal_set_node_type(::sundial_rpc::SundialResponse_NodeType value) {
-  
-  node_type_ = value;
-}
-inline void SundialResponse::set_node_type(::sundial_rpc::SundialResponse_NodeType value) {
-  _internal_set_node_type(value);
-  // @@protoc_insertion_point(field_set:sundial_rpc.SundialResponse.node_type)
-}
-
-#ifdef __GNUC__
-  #pragma GCC diagnostic pop
-#endif  // __GNUC__
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-
-// @@protoc_insertion_point(namespace_scope)
-
-}  // namespace sundial_rpc
-
-PROTOBUF_NAMESPACE_OPEN
-
-template <> struct is_proto_enum< ::sundial_rpc::SundialRequest_RequestType> : ::std::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::sundial_rpc::SundialRequest_RequestType>() {
-  return ::sundial_rpc::SundialRequest_RequestType_descriptor();
-}
-template <> struct is_proto_enum< ::sundial_rpc::SundialRequest_NodeType> : ::std::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::sundial_rpc::SundialRequest_NodeType>() {
-  return ::sundial_rpc::SundialRequest_NodeType_descriptor();
-}
-template <> struct is_proto_enum< ::sundial_rpc::SundialRequest_ResponseType> : ::std::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::sundial_rpc::SundialRequest_ResponseType>() {
-  return ::sundial_rpc::SundialRequest_ResponseType_descriptor();
-}
-template <> struct is_proto_enum< ::sundial_rpc::SundialResponse_RequestType> : ::std::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::sundial_rpc::SundialResponse_RequestType>() {
-  return ::sundial_rpc::SundialResponse_RequestType_descriptor();
-}
-template <> struct is_proto_enum< ::sundial_rpc::SundialResponse_ResponseType> : ::std::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::sundial_rpc::SundialResponse_ResponseType>() {
-  return ::sundial_rpc::SundialResponse_ResponseType_descriptor();
-}
-template <> struct is_proto_enum< ::sundial_rpc::SundialResponse_NodeType> : ::std::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::sundial_rpc::SundialResponse_NodeType>() {
-  return ::sundial_rpc::SundialResponse_NodeType_descriptor();
-}
-
-PROTOBUF_NAMESPACE_CLOSE
-
-// @@protoc_insertion_point(global_scope)
-
-#include <google/protobuf/port_undef.inc>
-#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_sundial_2eproto
@@ -6,6 +6,8 @@
 #include "row_tictoc.h"
 #include "row_f1.h"
 #include "row_occ.h"
+#include "row_mvcc.h"
+#include "row_maat.h"
 #include "manager.h"
 
 IndexHash::IndexHash(bool is_key_index)
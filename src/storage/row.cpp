@@ -8,6 +8,8 @@
 #include "row_f1.h"
 #include "row_tictoc.h"
 #include "row_occ.h"
+#include "row_mvcc.h"
+#include "row_maat.h"
 #include "manager.h"
 #include "workload.h"
 #include "index_hash.h"
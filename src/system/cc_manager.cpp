@@ -4,6 +4,8 @@
 #include "f1_manager.h"
 #include "tictoc_manager.h"
 #include "occ_manager.h"
+#include "mvcc_manager.h"
+#include "maat_manager.h"
 #include "index_btree.h"
 #include "index_hash.h"
 #include "manager.h"
@@ -0,0 +1,167 @@
+#include "det_scheduler.h"
+#include "manager.h"
+#include "workload.h"
+#include "query.h"
+#include "txn.h"
+#include "redis_client.h"
+#include "local_log_client.h"
+#include "azure_blob_client.h"
+
+#if DETERMINISTIC
+
+DetScheduler::DetScheduler()
+{
+    _slots = new Slot [DET_EPOCH_SIZE];
+    _next_slots = new Slot [DET_EPOCH_SIZE];
+    for (uint32_t i = 0; i < DET_EPOCH_SIZE; i++) {
+        _slots[i].query = NULL;
+        _slots[i].num_deps = 0;
+        _next_slots[i].query = NULL;
+        _next_slots[i].num_deps = 0;
+    }
+    // the first call to get_query() prepares and starts epoch 0.
+    _num_finished = DET_EPOCH_SIZE;
+    _next_state = NEXT_NONE;
+    _epoch_id = 0;
+    pthread_mutex_init(&_mutex, NULL);
+    pthread_cond_init(&_cond, NULL);
+}
+
+QueryBase *
+DetScheduler::get_query(uint32_t &slot)
+{
+    QueryBase * query = NULL;
+    pthread_mutex_lock(&_mutex);
+    if (_next_state == NEXT_NONE) {
+        // the log write of the next epoch does not hold up the others.
+        _next_state = NEXT_PREPARING;
+        pthread_mutex_unlock(&_mutex);
+        prepare_epoch();
+        pthread_mutex_lock(&_mutex);
+        _next_state = NEXT_READY;
+    }
+    new_epoch();
+    if (_ready.empty()) {
+        // wait for a predecessor to finish. The timeout lets the worker
+        // notice the end of the run.
+        timespec tp;
+        clock_gettime(CLOCK_REALTIME, &tp);
+        tp.tv_nsec += 1000 * 1000;
+        if (tp.tv_nsec >= 1000 * 1000 * 1000) {
+            tp.tv_sec ++;
+            tp.tv_nsec -= 1000 * 1000 * 1000;
+        }
+        pthread_cond_timedwait(&_cond, &_mutex, &tp);
+        new_epoch();
+    }
+    if (!_ready.empty()) {
+        slot = _ready.front();
+        _ready.pop();
+        query = _slots[slot].query;
+        _slots[slot].query = NULL;
+    }
+    pthread_mutex_unlock(&_mutex);
+    return query;
+}
+
+void
+DetScheduler::finish_query(uint32_t slot)
+{
+    pthread_mutex_lock(&_mutex);
+    for (auto next : _slots[slot].dependents) {
+        assert(_slots[next].num_deps > 0);
+        if (-- _slots[next].num_deps == 0)
+            _ready.push(next);
+    }
+    _slots[slot].dependents.clear();
+    _num_finished ++;
+    pthread_mutex_unlock(&_mutex);
+    // wake up the workers waiting for a ready query or for the next epoch.
+    pthread_cond_broadcast(&_cond);
+}
+
+void
+DetScheduler::new_epoch()
+{
+    if (!_ready.empty() || _num_finished < DET_EPOCH_SIZE
+        || _next_state != NEXT_READY)
+        return;
+    // the next epoch is already logged; swap it in.
+    std::swap(_slots, _next_slots);
+    for (auto i : _next_ready)
+        _ready.push(i);
+    _next_ready.clear();
+    _num_finished = 0;
+    _next_state = NEXT_NONE;
+    pthread_cond_broadcast(&_cond);
+}
+
+void
+DetScheduler::prepare_epoch()
+{
+    assert(_next_state == NEXT_PREPARING && _next_ready.empty());
+    struct KeyState {
+        int64_t             last_writer;
+        // readers since the last write
+        vector<uint32_t>    readers;
+    };
+    map<global_key_t, KeyState> key_states;
+    uint64_t num_writes = 0;
+    // epoch order is the order in which queries are generated.
+    for (uint32_t i = 0; i < DET_EPOCH_SIZE; i++) {
+        QueryBase * query = GET_WORKLOAD->gen_query();
+        vector<global_key_t> read_keys;
+        vector<global_key_t> write_keys;
+        query->get_read_keys(read_keys);
+        query->get_write_keys(write_keys);
+        num_writes += write_keys.size();
+
+        set<uint32_t> deps;
+        for (auto &key : read_keys) {
+            KeyState &state = key_states.insert(
+                std::make_pair(key, KeyState {-1, vector<uint32_t>()})).first->second;
+            if (state.last_writer >= 0)
+                deps.insert(state.last_writer);
+            state.readers.push_back(i);
+        }
+        for (auto &key : write_keys) {
+            KeyState &state = key_states.insert(
+                std::make_pair(key, KeyState {-1, vector<uint32_t>()})).first->second;
+            if (state.last_writer >= 0)
+                deps.insert(state.last_writer);
+            for (auto reader : state.readers)
+                deps.insert(reader);
+            state.last_writer = i;
+            state.readers.clear();
+        }
+        // a query may access the same key more than once.
+        deps.erase(i);
+
+        assert(_next_slots[i].query == NULL && _next_slots[i].dependents.empty());
+        _next_slots[i].query = query;
+        _next_slots[i].num_deps = deps.size();
+        for (auto dep : deps)
+            _next_slots[dep].dependents.push_back(i);
+        if (deps.empty())
+            _next_ready.push_back(i);
+    }
+
+    // log the input of the epoch. The txns are replayed from it on recovery.
+    if (num_writes > 0) {
+        uint64_t log_id = _epoch_id * g_num_nodes + g_node_id;
+        string data = "[LSN] placehold:" + string(num_writes * g_log_sz * 8, 'd');
+    #if LOG_DEVICE == LOG_DVC_REDIS || LOG_DEVICE == LOG_DVC_CUSTOMIZED
+        redis_client->log_sync_data(g_node_id, log_id, TxnManager::COMMITTED, data);
+    #elif LOG_DEVICE == LOG_DVC_LOCAL_FILE
+        local_log_client->log_sync_data(g_node_id, log_id, TxnManager::COMMITTED,
+            data);
+    #elif LOG_DEVICE == LOG_DVC_AZURE_BLOB
+        azure_blob_client->log_sync_data(g_node_id, log_id, TxnManager::COMMITTED,
+            data);
+    #endif
+    }
+    _epoch_id ++;
+    INC_INT_STATS(num_det_epochs, 1);
+}
+
+#endif
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <queue>
+#include "global.h"
+
+class QueryBase;
+
+// Deterministic (Calvin-style) scheduler for single-partition transactions.
+// Transactions are generated in epochs of DET_EPOCH_SIZE. The input of an
+// epoch is logged once, before any of its transactions runs. Two transactions
+// of the same epoch conflict if they access a common key and one of them
+// writes it; the later one in the epoch then waits for the earlier one.
+// Since conflicting transactions never overlap, they run without row locks and
+// can neither abort on a conflict nor need to log their outcome.
+// A new epoch starts only after all transactions of the previous one finished.
+// The next epoch is generated and logged by one worker, outside _mutex, while
+// the current one runs.
+class DetScheduler
+{
+public:
+    DetScheduler();
+
+    // return a query whose predecessors in the epoch have all finished, or
+    // NULL if none is ready yet. slot identifies the query in finish_query().
+    QueryBase * get_query(uint32_t &slot);
+    void        finish_query(uint32_t slot);
+
+private:
+    struct Slot {
+        QueryBase *         query;
+        // number of unfinished predecessors
+        uint32_t            num_deps;
+        vector<uint32_t>    dependents;
+    };
+    enum NextState {
+        NEXT_NONE,
+        NEXT_PREPARING,
+        NEXT_READY
+    };
+    // generate, order and log the next epoch into _next_slots. Called
+    // without _mutex by the worker that set NEXT_PREPARING.
+    void        prepare_epoch();
+    // start the next epoch once the current one is done. Called with _mutex
+    // held.
+    void        new_epoch();
+
+    Slot *              _slots;
+    std::queue<uint32_t> _ready;
+    uint32_t            _num_finished;
+
+    Slot *              _next_slots;
+    vector<uint32_t>    _next_ready;
+    NextState           _next_state;
+    uint64_t            _epoch_id;
+
+    pthread_mutex_t     _mutex;
+    pthread_cond_t      _cond;
+};
@@ -0,0 +1,177 @@
+#include "failure_detector.h"
+#include "manager.h"
+#include "txn.h"
+#include "txn_table.h"
+#include "redis_client.h"
+#include "local_log_client.h"
+#include "azure_blob_client.h"
+
+FailureDetector::FailureDetector(uint32_t thd_id)
+{
+    _thd_id = thd_id;
+    _last_heard = new uint64_t [g_num_nodes];
+    _pending = new bool [g_num_nodes];
+    _suspected = new bool [g_num_nodes];
+    _requests = new SundialRequest [g_num_nodes];
+    _responses = new SundialResponse [g_num_nodes];
+    uint64_t now = get_sys_clock();
+    for (uint32_t i = 0; i < g_num_nodes; i++) {
+        _last_heard[i] = now;
+        _pending[i] = false;
+        _suspected[i] = false;
+    }
+    new std::thread(Run, this);
+}
+
+void
+FailureDetector::heard_from(uint64_t node_id)
+{
+    _last_heard[node_id] = get_sys_clock();
+    _pending[node_id] = false;
+    _suspected[node_id] = false;
+}
+
+void
+FailureDetector::send_heartbeats()
+{
+    for (uint32_t i = 0; i < g_num_nodes; i++) {
+        // a node is not sent another heartbeat before the last one is
+        // answered or failed; its request may still be in use.
+        if (i == g_node_id || _pending[i])
+            continue;
+        _pending[i] = true;
+        _requests[i].set_request_type(SundialRequest::HEARTBEAT);
+        _requests[i].set_node_id(g_node_id);
+        _requests[i].set_receiver_id(i);
+        if (rpc_client->sendRequestAsync(nullptr, i, _requests[i],
+                                         _responses[i]) != RCOK)
+            _pending[i] = false;
+    }
+}
+
+void
+FailureDetector::terminate_txns(uint64_t node_id, uint64_t fail_time)
+{
+#if DEBUG_FAILURE || DEBUG_PRINT
+    printf("[node-%u] node-%lu is suspected to have failed\n", g_node_id, node_id);
+#endif
+    // the participants of the txns coordinated by the failed node, which
+    // hold their locks until they learn the decision.
+    uint64_t num_blocked = 0;
+    vector<uint64_t> txn_ids;
+    txn_table->find_txns([node_id, &num_blocked](TxnManager * txn) {
+        if (txn->is_coordinator() || txn->get_txn_id() % g_num_nodes != node_id)
+            return false;
+        TxnManager::State state = txn->get_txn_state();
+        if (state != TxnManager::RUNNING && state != TxnManager::PREPARED)
+            return false;
+        num_blocked ++;
+#if COMMIT_ALG == TWO_PC
+        // the decision is only logged by the coordinator; a prepared
+        // participant stays blocked until the coordinator recovers.
+        return state == TxnManager::RUNNING;
+#else
+        return true;
+#endif
+    }, txn_ids);
+    INC_INT_STATS(num_blocked_txns, num_blocked);
+
+    vector<TxnManager *> batch;
+    for (auto txn_id : txn_ids) {
+        // claiming the txn waits for the handlers of its requests and makes
+        // the later ones, including a late decision request, skip it.
+        TxnManager * txn = txn_table->get_txn(txn_id, true, true);
+        if (txn == nullptr)
+            continue;
+        TxnManager::State state = txn->get_txn_state();
+        if (state != TxnManager::RUNNING && state != TxnManager::PREPARED) {
+            // a handler ended the sub-txn before the claim; it was left to us
+            // to remove.
+            txn_table->remove_txn(txn);
+            delete txn;
+            continue;
+        }
+#if COMMIT_ALG == TWO_PC
+        if (state == TxnManager::PREPARED) {
+            // it voted before the claim; it stays blocked.
+            txn_table->unclaim_txn(txn);
+            continue;
+        }
+#endif
+        batch.push_back(txn);
+        if (batch.size() == TERMINATION_BATCH_SIZE)
+            terminate_batch(batch, fail_time);
+    }
+    terminate_batch(batch, fail_time);
+}
+
+void
+FailureDetector::terminate_batch(vector<TxnManager *> & batch, uint64_t fail_time)
+{
+    // the log_if_ne requests of all the txns are grouped by the log they go
+    // to, and each group is sent as one request before waiting for any.
+    std::map<uint64_t, vector<TxnManager *> > lookups;
+    for (auto txn : batch) {
+        txn->lock();
+        txn->start_termination(&lookups);
+    }
+    for (auto & kvp : lookups)
+        send_lookups(kvp.first, kvp.second);
+    for (auto txn : batch) {
+        txn->finish_termination();
+        txn->unlock();
+        INC_FLOAT_STATS(time_unblock, get_sys_clock() - fail_time);
+        txn_table->remove_txn(txn);
+        delete txn;
+    }
+    batch.clear();
+}
+
+void
+FailureDetector::send_lookups(uint64_t node_id, const vector<TxnManager *> & txns)
+{
+    vector<uint64_t> txn_ids;
+    for (auto txn : txns)
+        txn_ids.push_back(txn->get_txn_id());
+    std::function<void(const vector<int> &)> callback =
+        [txns](const vector<int> & statuses) {
+        for (size_t i = 0; i < txns.size(); i++)
+            txns[i]->resolve_termination((TxnManager::State) statuses[i]);
+    };
+    RC rc = RCOK;
+#if LOG_DEVICE == LOG_DVC_REDIS || LOG_DEVICE == LOG_DVC_CUSTOMIZED
+    rc = redis_client->log_if_ne_batch(node_id, txn_ids, callback);
+#elif LOG_DEVICE == LOG_DVC_LOCAL_FILE
+    rc = local_log_client->log_if_ne_batch(node_id, txn_ids, callback);
+#elif LOG_DEVICE == LOG_DVC_AZURE_BLOB
+    rc = azure_blob_client->log_if_ne_batch(node_id, txn_ids, callback);
+#endif
+    if (rc == FAIL) {
+        // self is down
+        for (auto txn : txns) {
+            txn->set_decision(FAIL);
+            txn->rpc_log_semaphore->decr();
+        }
+    }
+}
+
+void
+FailureDetector::Run(FailureDetector * detector)
+{
+    glob_manager->set_thd_id(detector->_thd_id);
+    while (glob_manager->active) {
+        usleep(HEARTBEAT_INTERVAL);
+        detector->send_heartbeats();
+        uint64_t now = get_sys_clock();
+        for (uint32_t i = 0; i < g_num_nodes; i++) {
+            if (i == g_node_id || detector->_suspected[i])
+                continue;
+            uint64_t last_heard = detector->_last_heard[i];
+            if (now < last_heard + HEARTBEAT_TIMEOUT * 1000UL)
+                continue;
+            detector->_suspected[i] = true;
+            INC_INT_STATS(num_suspected_nodes, 1);
+            detector->terminate_txns(i, last_heard);
+        }
+    }
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "global.h"
+#include "rpc_client.h"
+
+class TxnManager;
+
+// Heartbeat failure detector of a compute node.
+// Every HEARTBEAT_INTERVAL, a HEARTBEAT is sent to each other compute node that
+// answered the previous one. A node that has not answered for
+// HEARTBEAT_TIMEOUT is suspected to have failed, and the txns of this node
+// coordinated by it are terminated, TERMINATION_BATCH_SIZE at a time: the
+// termination protocols of a batch run in parallel, and their conditional
+// writes to the log of each node are sent as a single batch.
+// A heartbeat not answered within HEARTBEAT_TIMEOUT fails, and the next one
+// is sent; a node that answers again is no longer suspected.
+class FailureDetector
+{
+public:
+    // the detector thread counts its stats as thread thd_id.
+    FailureDetector(uint32_t thd_id);
+
+    // node_id answered a heartbeat.
+    void        heard_from(uint64_t node_id);
+    // the heartbeat to node_id was not answered in time.
+    void        heartbeat_failed(uint64_t node_id) { _pending[node_id] = false; }
+    bool        is_suspected(uint64_t node_id) { return _suspected[node_id]; }
+    static void Run(FailureDetector * detector);
+
+private:
+    void        send_heartbeats();
+    // terminate the txns blocked on node_id, last heard from at fail_time.
+    void        terminate_txns(uint64_t node_id, uint64_t fail_time);
+    void        terminate_batch(vector<TxnManager *> & batch, uint64_t fail_time);
+    // one log_if_ne_batch on the log of node_id for txns.
+    void        send_lookups(uint64_t node_id, const vector<TxnManager *> & txns);
+
+    // per compute node
+    volatile uint64_t *     _last_heard;
+    // a heartbeat is in flight; its request and response are in use.
+    volatile bool *         _pending;
+    volatile bool *         _suspected;
+    SundialRequest *        _requests;
+    SundialResponse *       _responses;
+    uint32_t                _thd_id;
+};
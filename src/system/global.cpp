@@ -6,6 +6,7 @@
 #include "rpc_server.h"
 #include "redis_client.h"
 #include "azure_blob_client.h"
+#include "local_log_client.h"
 
 Stats *             glob_stats;
 Manager *           glob_manager;
@@ -59,6 +60,8 @@ uint32_t        g_cust_per_dist         = 3000;
 #endif
 
 char            ifconfig_file[80]       = "ifconfig.txt";
+char            delay_matrix_file[80]   = "delay_matrix.txt";
+char            log_file_dir[80]        = ".";
 
 // TICTOC
 uint32_t        g_max_num_waits         = MAX_NUM_WAITS;
@@ -86,6 +89,7 @@ SundialRPCClient *  rpc_client;
 SundialRPCServerImpl * rpc_server;
 RedisClient *       redis_client;
 AzureBlobClient *       azure_blob_client;
+LocalLogClient *    local_log_client;
 
 Transport *     transport;
 //InOutQueue **   input_queues;
@@ -95,6 +99,13 @@ WorkerThread ** worker_threads;
 // TODO. tune this table size
 uint32_t        g_txn_table_size        = NUM_WORKER_THREADS * 10; // TODO:
 TxnTable *      txn_table;
+// [MAAT]
+TimeTable *     time_table;
+HotKeyTracker * hot_key_tracker;
+DetScheduler *  det_scheduler;
+PaxosLog *      paxos_log;
+LazyLog *       lazy_log;
+FailureDetector * failure_detector;
 
 FreeQueue *     free_queue_txn_man;
 uint32_t        g_dummy_size            = 0;
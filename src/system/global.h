@@ -40,6 +40,12 @@ class Query_queue;
 class Plock;
 class VLLMan;
 class TxnTable;
+class TimeTable;
+class HotKeyTracker;
+class DetScheduler;
+class PaxosLog;
+class LazyLog;
+class FailureDetector;
 class Transport;
 class FreeQueue;
 class CacheManager;
@@ -50,6 +56,7 @@ class SundialRPCClient;
 class SundialRPCServerImpl;
 class RedisClient;
 class AzureBlobClient;
+class LocalLogClient;
 
 typedef uint64_t ts_t; // time stamp type
 
@@ -111,6 +118,8 @@ extern double           g_perc_order_status;
 extern double           g_perc_delivery;
 
 extern char             ifconfig_file[];
+extern char             delay_matrix_file[];
+extern char             log_file_dir[];
 
 enum RC {RCOK, COMMIT, ABORT, WAIT, LOCAL_MISS, SPECULATE, ERROR, FINISH, FAIL};
 enum access_t {RD, WR, XP, SCAN, INS, DEL};
@@ -210,11 +219,21 @@ extern RedisClient *      redis_client;
 #if LOG_DEVICE == LOG_DVC_AZURE_BLOB
 extern AzureBlobClient *      azure_blob_client;
 #endif
+#if LOG_DEVICE == LOG_DVC_LOCAL_FILE
+extern LocalLogClient *   local_log_client;
+#endif
 
 extern Transport *      transport;
 extern WorkerThread **  worker_threads;
 extern uint32_t         g_txn_table_size;
 extern TxnTable *       txn_table;
+// [MAAT]
+extern TimeTable *      time_table;
+extern HotKeyTracker *  hot_key_tracker;
+extern DetScheduler *   det_scheduler;
+extern PaxosLog *       paxos_log;
+extern LazyLog *        lazy_log;
+extern FailureDetector * failure_detector;
 
 extern FreeQueue *      free_queue_txn_man;
 
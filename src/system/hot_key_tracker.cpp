@@ -0,0 +1,188 @@
+#include <algorithm>
+#include "hot_key_tracker.h"
+#include "manager.h"
+#include "workload.h"
+#include "query.h"
+
+#if HOT_KEY_TRACKING
+
+HotKeyTracker::HotKeyTracker()
+{
+    _num_sketches = g_num_worker_threads;
+    _sketches = (Sketch *) _mm_malloc(sizeof(Sketch) * _num_sketches, 64);
+    for (uint32_t i = 0; i < _num_sketches; i++) {
+        _sketches[i].entries = new Entry [HOT_KEY_SKETCH_SIZE];
+        _sketches[i].size = 0;
+        _sketches[i].num_conflicts = 0;
+        _sketches[i].latch = false;
+    }
+    _hot_set = new vector<uint64_t>;
+    _retired_set = NULL;
+    _last_merge_time = get_sys_clock();
+#if HOT_KEY_BATCHING
+    pthread_mutex_init(&_queues_latch, NULL);
+    _entered = new vector<BatchQueue *> [g_num_worker_threads];
+#endif
+}
+
+void
+HotKeyTracker::latch(Sketch * sketch)
+{
+    while ( !ATOM_CAS(sketch->latch, false, true) )
+        PAUSE
+    COMPILER_BARRIER
+}
+
+void
+HotKeyTracker::unlatch(Sketch * sketch)
+{
+    COMPILER_BARRIER
+    sketch->latch = false;
+}
+
+void
+HotKeyTracker::record(uint32_t table_id, uint64_t key)
+{
+    Sketch * sketch = &_sketches[GET_THD_ID % _num_sketches];
+    // only sample one out of HOT_KEY_SAMPLE_RATE conflicts.
+    if (sketch->num_conflicts ++ % HOT_KEY_SAMPLE_RATE != 0)
+        return;
+    INC_INT_STATS(num_hot_key_samples, 1);
+    uint64_t id = get_id(table_id, key);
+    latch(sketch);
+    // space-saving: if the key is not tracked, it replaces the entry with the
+    // smallest count and inherits that count.
+    Entry * min_entry = NULL;
+    for (uint32_t i = 0; i < sketch->size; i++) {
+        Entry * entry = &sketch->entries[i];
+        if (entry->id == id) {
+            entry->count ++;
+            unlatch(sketch);
+            return;
+        }
+        if (!min_entry || entry->count < min_entry->count)
+            min_entry = entry;
+    }
+    if (sketch->size < HOT_KEY_SKETCH_SIZE) {
+        Entry * entry = &sketch->entries[sketch->size ++];
+        entry->id = id;
+        entry->count = 1;
+    } else {
+        min_entry->id = id;
+        min_entry->count ++;
+    }
+    unlatch(sketch);
+}
+
+void
+HotKeyTracker::try_merge()
+{
+    if (get_sys_clock() - _last_merge_time < HOT_KEY_MERGE_INTVL * 1000UL)
+        return;
+    _last_merge_time = get_sys_clock();
+
+    map<uint64_t, uint64_t> counts;
+    for (uint32_t i = 0; i < _num_sketches; i++) {
+        Sketch * sketch = &_sketches[i];
+        latch(sketch);
+        uint32_t size = 0;
+        for (uint32_t j = 0; j < sketch->size; j++) {
+            Entry &entry = sketch->entries[j];
+            counts[entry.id] += entry.count;
+            // age the counts so that keys which cool down leave the hot set.
+            entry.count /= 2;
+            if (entry.count > 0)
+                sketch->entries[size ++] = entry;
+        }
+        sketch->size = size;
+        unlatch(sketch);
+    }
+
+    vector<uint64_t> * hot_set = new vector<uint64_t>;
+    for (auto it : counts)
+        if (it.second >= HOT_KEY_THRESHOLD)
+            hot_set->push_back(it.first);
+    // map iteration order keeps the set sorted.
+    INC_INT_STATS(num_hot_key_merges, 1);
+    INC_INT_STATS(num_hot_keys, hot_set->size());
+
+    if (_retired_set)
+        delete _retired_set;
+    _retired_set = _hot_set;
+    COMPILER_BARRIER
+    _hot_set = hot_set;
+}
+
+bool
+HotKeyTracker::is_hot(uint32_t table_id, uint64_t key)
+{
+    vector<uint64_t> * hot_set = _hot_set;
+    return std::binary_search(hot_set->begin(), hot_set->end(),
+                              get_id(table_id, key));
+}
+
+#if HOT_KEY_BATCHING
+HotKeyTracker::BatchQueue *
+HotKeyTracker::get_queue(uint64_t id)
+{
+    BatchQueue * queue;
+    pthread_mutex_lock(&_queues_latch);
+    auto it = _queues.find(id);
+    if (it == _queues.end()) {
+        queue = new BatchQueue;
+        pthread_mutex_init(&queue->mutex, NULL);
+        pthread_cond_init(&queue->cond, NULL);
+        queue->next_ticket = 0;
+        queue->now_serving = 0;
+        _queues[id] = queue;
+    } else
+        queue = it->second;
+    pthread_mutex_unlock(&_queues_latch);
+    return queue;
+}
+
+void
+HotKeyTracker::enter_batch(QueryBase * query)
+{
+    vector<BatchQueue *> &entered = _entered[GET_THD_ID];
+    assert(entered.empty());
+    vector<std::pair<uint32_t, uint64_t> > keys;
+    query->get_write_keys(keys);
+    vector<uint64_t> ids;
+    // only the hot keys of this node are known.
+    for (auto &it : keys)
+        if (is_hot(it.first, it.second))
+            ids.push_back(get_id(it.first, it.second));
+    if (ids.empty())
+        return;
+    // enter the queues in a global order to avoid deadlocks.
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    INC_INT_STATS(num_hot_key_batched, 1);
+    for (auto id : ids) {
+        BatchQueue * queue = get_queue(id);
+        pthread_mutex_lock(&queue->mutex);
+        uint64_t ticket = queue->next_ticket ++;
+        while (queue->now_serving != ticket)
+            pthread_cond_wait(&queue->cond, &queue->mutex);
+        pthread_mutex_unlock(&queue->mutex);
+        entered.push_back(queue);
+    }
+}
+
+void
+HotKeyTracker::exit_batch()
+{
+    vector<BatchQueue *> &entered = _entered[GET_THD_ID];
+    for (auto it = entered.rbegin(); it != entered.rend(); it ++) {
+        BatchQueue * queue = *it;
+        pthread_mutex_lock(&queue->mutex);
+        queue->now_serving ++;
+        pthread_mutex_unlock(&queue->mutex);
+        pthread_cond_broadcast(&queue->cond);
+    }
+    entered.clear();
+}
+#endif
+
+#endif
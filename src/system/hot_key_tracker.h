@@ -0,0 +1,77 @@
+#pragma once
+
+#include "global.h"
+
+class QueryBase;
+
+// Sampled tracker of contended keys.
+// Every thread records a sample of the lock conflicts it observes into its own
+// small sketch (space-saving counters). Worker thread 0 periodically merges the
+// sketches into a per-node hot set, which is read without latches.
+//
+// With HOT_KEY_BATCHING, a transaction that writes a local hot key is queued on
+// that key before it starts. Queued transactions are admitted in FIFO order,
+// so a batch of transactions on the same hot row modifies it one after another
+// instead of racing for the row lock and aborting.
+class HotKeyTracker
+{
+public:
+    HotKeyTracker();
+
+    // called on a lock conflict (ABORT or WAIT) on a row.
+    void        record(uint32_t table_id, uint64_t key);
+    // merge the thread sketches if HOT_KEY_MERGE_INTVL has passed.
+    void        try_merge();
+    bool        is_hot(uint32_t table_id, uint64_t key);
+
+#if HOT_KEY_BATCHING
+    // wait for the turn of the calling worker thread on every local hot key
+    // written by the query. Must be followed by exit_batch().
+    void        enter_batch(QueryBase * query);
+    void        exit_batch();
+#endif
+
+private:
+    static uint64_t get_id(uint32_t table_id, uint64_t key)
+    { return key ^ ((uint64_t)table_id << 56); }
+
+    struct Entry {
+        uint64_t    id;
+        uint64_t    count;
+    };
+    struct Sketch {
+        Entry *     entries;
+        uint32_t    size;
+        uint64_t    num_conflicts;
+        volatile bool latch;
+    } __attribute__ ((aligned(64)));
+
+    void        latch(Sketch * sketch);
+    void        unlatch(Sketch * sketch);
+
+    // RPC threads do not have their own thread id and share sketch 0,
+    // so each sketch is protected by a latch.
+    Sketch *    _sketches;
+    uint32_t    _num_sketches;
+
+    // sorted ids of the hot keys. The previous set is freed at the next
+    // merge, so readers never see a freed set.
+    vector<uint64_t> * volatile _hot_set;
+    vector<uint64_t> *          _retired_set;
+    uint64_t                    _last_merge_time;
+
+#if HOT_KEY_BATCHING
+    struct BatchQueue {
+        pthread_mutex_t mutex;
+        pthread_cond_t  cond;
+        uint64_t        next_ticket;
+        uint64_t        now_serving;
+    };
+    BatchQueue *        get_queue(uint64_t id);
+
+    std::map<uint64_t, BatchQueue *> _queues;
+    pthread_mutex_t     _queues_latch;
+    // queues entered by each worker thread.
+    vector<BatchQueue *> * _entered;
+#endif
+};
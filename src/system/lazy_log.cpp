@@ -0,0 +1,67 @@
+#include "lazy_log.h"
+#include "manager.h"
+#include "redis_client.h"
+#include "local_log_client.h"
+#include "azure_blob_client.h"
+
+LazyLog::LazyLog()
+{
+    pthread_mutex_init(&_latch, NULL);
+    _batch_start_time = 0;
+    new std::thread(FlushBatches, this);
+}
+
+void
+LazyLog::append(uint64_t txn_id, int status)
+{
+    vector<uint64_t> txn_ids;
+    vector<int> statuses;
+    pthread_mutex_lock(&_latch);
+    if (_txn_ids.empty())
+        _batch_start_time = get_sys_clock();
+    _txn_ids.push_back(txn_id);
+    _statuses.push_back(status);
+    if (_txn_ids.size() >= LAZY_LOG_BATCH_SIZE) {
+        txn_ids.swap(_txn_ids);
+        statuses.swap(_statuses);
+    }
+    pthread_mutex_unlock(&_latch);
+    if (!txn_ids.empty())
+        flush(txn_ids, statuses);
+}
+
+void
+LazyLog::flush(vector<uint64_t> & txn_ids, vector<int> & statuses)
+{
+    INC_INT_STATS(num_lazy_log_batches, 1);
+    INC_INT_STATS(num_lazy_log_records, txn_ids.size());
+#if LOG_DEVICE == LOG_DVC_REDIS || LOG_DEVICE == LOG_DVC_CUSTOMIZED
+    redis_client->log_async_batch(g_node_id, txn_ids, statuses, []() {});
+#elif LOG_DEVICE == LOG_DVC_LOCAL_FILE
+    local_log_client->log_async_batch(g_node_id, txn_ids, statuses, []() {});
+#elif LOG_DEVICE == LOG_DVC_AZURE_BLOB
+    azure_blob_client->log_async_batch(g_node_id, txn_ids, statuses, []() {});
+#endif
+}
+
+void
+LazyLog::FlushBatches(LazyLog * log)
+{
+    vector<uint64_t> txn_ids;
+    vector<int> statuses;
+    while (true) {
+        usleep(LAZY_LOG_TIMEOUT);
+        pthread_mutex_lock(&log->_latch);
+        if (!log->_txn_ids.empty()
+            && get_sys_clock() - log->_batch_start_time >= LAZY_LOG_TIMEOUT * 1000UL) {
+            txn_ids.swap(log->_txn_ids);
+            statuses.swap(log->_statuses);
+        }
+        pthread_mutex_unlock(&log->_latch);
+        if (!txn_ids.empty()) {
+            log->flush(txn_ids, statuses);
+            txn_ids.clear();
+            statuses.clear();
+        }
+    }
+}
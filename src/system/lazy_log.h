@@ -0,0 +1,25 @@
+#pragma once
+
+#include "global.h"
+
+// Decision records of TWO_PC that the presumption does not need forced (see
+// TWO_PC_PRESUME). Nobody waits for them: they are buffered and written in
+// batches of up to LAZY_LOG_BATCH_SIZE records, or whatever arrived within
+// LAZY_LOG_TIMEOUT.
+class LazyLog
+{
+public:
+    LazyLog();
+
+    void        append(uint64_t txn_id, int status);
+    // write the open batch once it waited LAZY_LOG_TIMEOUT.
+    static void FlushBatches(LazyLog * log);
+
+private:
+    void        flush(vector<uint64_t> & txn_ids, vector<int> & statuses);
+
+    pthread_mutex_t     _latch;
+    vector<uint64_t>    _txn_ids;
+    vector<int>         _statuses;
+    uint64_t            _batch_start_time;
+};
@@ -11,13 +11,22 @@
 #include "manager.h"
 #include "query.h"
 #include "txn_table.h"
+#include "time_table.h"
+#include "hot_key_tracker.h"
+#include "det_scheduler.h"
+#include "paxos_log.h"
+#include "lazy_log.h"
+#include "failure_detector.h"
 #include "rpc_server.h"
 #include "rpc_client.h"
 #include "redis_client.h"
+#include "local_log_client.h"
 #include "azure_blob_client.h"
+#include "row_mvcc.h"
 
 void * start_thread(void *);
 void * start_rpc_server(void *);
+void * start_gc_thread(void *);
 
 // defined in parser.cpp
 void parser(int argc, char ** argv);
@@ -32,10 +41,35 @@ int main(int argc, char* argv[])
     cout << "[Sundial] start storage node " << g_node_id << endl;
 #endif
     g_total_num_threads = g_num_worker_threads;
+#if FAILURE_DETECTOR
+    // the failure detector thread has its own stats
+    g_total_num_threads ++;
+#endif
 
     glob_manager = new Manager;
     txn_table = new TxnTable();
+#if CC_ALG == MAAT
+    time_table = new TimeTable();
+#endif
+    assert(HOT_KEY_TRACKING || !HOT_KEY_BATCHING);
+    assert(!SKIP_READONLY_PREPARE || CC_ALG == IDEAL_MVCC);
+    assert(!EARLY_CLIENT_ACK || COMMIT_ALG == ONE_PC);
+#if HOT_KEY_TRACKING
+    hot_key_tracker = new HotKeyTracker();
+#endif
+    assert(!DETERMINISTIC || ((CC_ALG == NO_WAIT || CC_ALG == WAIT_DIE)
+                              && !EARLY_LOCK_RELEASE && !HOT_KEY_BATCHING));
+    // the epoch of a node only orders its own keys. TPCC ignores
+    // SINGLE_PART_ONLY.
+    assert(!DETERMINISTIC || g_num_nodes == 1
+           || (WORKLOAD == YCSB && SINGLE_PART_ONLY));
+#if DETERMINISTIC
+    det_scheduler = new DetScheduler();
+#endif
     glob_manager->calibrate_cpu_frequency();
+#if NODE_TYPE == STORAGE_NODE
+    paxos_log = new PaxosLog();
+#endif
 
 #if DISTRIBUTED || NUM_STORAGE_NODES > 0
     rpc_client = new SundialRPCClient();
@@ -50,7 +84,18 @@ int main(int argc, char* argv[])
     #elif LOG_DEVICE == LOG_DVC_AZURE_BLOB
         cout << "[Sundial] creating Azure Blob client" << endl;
         azure_blob_client = new AzureBlobClient();
+    #elif LOG_DEVICE == LOG_DVC_LOCAL_FILE
+        cout << "[Sundial] creating local file log" << endl;
+      #if NODE_TYPE == COMPUTE_NODE
+        // other nodes could neither read nor write it to terminate our txns.
+        M_ASSERT(g_num_nodes == 1, "a local file log is not shared; use it "
+                 "on storage nodes or with a single compute node\n");
+      #endif
+        local_log_client = new LocalLogClient();
     #endif
+#if NODE_TYPE == COMPUTE_NODE && COMMIT_ALG == TWO_PC && TWO_PC_PRESUME != PRESUME_NOTHING
+    lazy_log = new LazyLog();
+#endif
 
     glob_stats = new Stats;
 
@@ -76,11 +121,11 @@ int main(int argc, char* argv[])
 #if NODE_TYPE == COMPUTE_NODE
     uint64_t starttime;
     uint64_t endtime;
-    pthread_barrier_init( &global_barrier, nullptr, g_total_num_threads);
+    pthread_barrier_init( &global_barrier, nullptr, g_num_worker_threads);
     pthread_mutex_init( &global_lock, nullptr);
 
     // Thread numbering:
-    //    worker_threads | input_thread | output_thread | logging_thread
+    //    worker_threads | failure_detector
     uint32_t next_thread_id = 0;
     worker_threads = new WorkerThread * [g_num_worker_threads];
     pthread_t ** pthreads_worker = new pthread_t * [g_num_worker_threads];
@@ -106,6 +151,10 @@ int main(int argc, char* argv[])
         usleep(1);
     cout << "[Sundial] Synchronization done" << endl;
 #endif
+#if FAILURE_DETECTOR
+    // every compute node is up; start watching them.
+    failure_detector = new FailureDetector(next_thread_id ++);
+#endif
 #if NUM_STORAGE_NODES > 0
     sleep(g_num_storage_nodes * 3);
     cout << "[Sundial] Synchronize with Storage Nodes" << endl;
@@ -117,6 +166,11 @@ int main(int argc, char* argv[])
     }
 #endif
 
+#if CC_ALG == IDEAL_MVCC
+    // background garbage collection of old versions
+    pthread_t * pthread_gc = new pthread_t;
+    pthread_create(pthread_gc, nullptr, start_gc_thread, nullptr);
+#endif
     for (uint64_t i = 0; i < g_num_worker_threads - 1; i++)
         pthread_create(pthreads_worker[i], nullptr, start_thread, (void *)
                                                               worker_threads[i]);
@@ -196,3 +250,10 @@ void * start_rpc_server(void * input) {
     return nullptr;
 }
 
+void * start_gc_thread(void * input) {
+#if CC_ALG == IDEAL_MVCC
+    Row_MVCC::garbage_collect();
+#endif
+    return nullptr;
+}
+
@@ -4,23 +4,33 @@
 #include "pthread.h"
 #include "worker_thread.h"
 #include "config.h"
+#include "rpc_client.h"
 
 __thread drand48_data Manager::_buffer;
 __thread uint64_t Manager::_thread_id;
 __thread uint64_t Manager::_max_cts = 1;
+__thread TsLease Manager::_ts_lease = {0, 0};
 
 Manager::Manager() {
     timestamp = (uint64_t *) _mm_malloc(sizeof(uint64_t), 64);
     *timestamp = 1;
     _last_min_ts_time = 0;
     _min_ts = 0;
+    _local_min_ts = 0;
+    pthread_mutex_init(&_remote_ts_mutex, NULL);
     // For MVCC garbage collection
     all_ts = (ts_t volatile **) _mm_malloc(sizeof(ts_t *) * g_num_worker_threads, 64);
     for (uint32_t i = 0; i < g_num_worker_threads; i++)
         all_ts[i] = (ts_t *) _mm_malloc(sizeof(ts_t), 64);
 
+    // a thread keeps its last snapshot in its slot until it takes the next
+    // one, which is not lower. The slot is therefore never above a snapshot
+    // the thread takes later, even one taken but not registered yet.
     for (uint32_t i = 0; i < g_num_worker_threads; i++)
-        *all_ts[i] = UINT64_MAX;
+        *all_ts[i] = 0;
+    _node_min_ts = new uint64_t [g_num_nodes];
+    for (uint32_t i = 0; i < g_num_nodes; i++)
+        _node_min_ts[i] = 0;
 
     _num_finished_worker_threads = 0;
     _num_sync_received = 0;
@@ -37,7 +47,7 @@ Manager::Manager() {
 uint64_t
 Manager::get_ts(uint64_t thread_id) {
     if (g_ts_batch_alloc)
-        assert(g_ts_alloc == TS_CAS);
+        assert(g_ts_alloc == TS_CAS || g_ts_alloc == TS_HLC);
     uint64_t time = 0;
     switch(g_ts_alloc) {
     case TS_MUTEX :
@@ -47,7 +57,7 @@ Manager::get_ts(uint64_t thread_id) {
         break;
     case TS_CAS :
         if (g_ts_batch_alloc)
-            time = ATOM_FETCH_ADD((*timestamp), g_ts_batch_num);
+            time = lease_cas_ts(_ts_lease, timestamp, g_ts_batch_num);
         else
             time = ATOM_FETCH_ADD((*timestamp), 1);
         break;
@@ -57,12 +67,22 @@ Manager::get_ts(uint64_t thread_id) {
     case TS_CLOCK :
         time = (get_sys_clock() * g_num_worker_threads + thread_id) * g_num_nodes + g_node_id;
         break;
+    case TS_HLC :
+        time = get_hlc_ts() * g_num_nodes + g_node_id;
+        break;
     default :
         assert(false);
     }
     return time;
 }
 
+uint64_t
+Manager::get_hlc_ts() {
+    if (!g_ts_batch_alloc)
+        return _hlc.now();
+    return lease_hlc_ts(_ts_lease, _hlc, g_ts_batch_num);
+}
+
 void
 Manager::calibrate_cpu_frequency()
 {
@@ -93,6 +113,20 @@ Manager::get_min_ts(uint64_t tid) {
         for (uint32_t i = 0; i < g_num_worker_threads; i++)
             if (*all_ts[i] < min)
                 min = *all_ts[i];
+        if (min > _local_min_ts)
+            _local_min_ts = min;
+        // a snapshot of another node is registered when its read arrives,
+        // which may be after this pass. It is not below the local min ts last
+        // received from its node: the snapshot was still active, or not taken
+        // yet, when the node computed it. A node not heard from yet holds
+        // garbage collection back.
+        for (uint32_t i = 0; i < g_num_nodes; i++)
+            if (i != g_node_id && _node_min_ts[i] < min)
+                min = _node_min_ts[i];
+        pthread_mutex_lock( &_remote_ts_mutex );
+        if (!_remote_ts.empty() && *_remote_ts.begin() < min)
+            min = *_remote_ts.begin();
+        pthread_mutex_unlock( &_remote_ts_mutex );
         if (min > _min_ts)
             _min_ts = min;
     }
@@ -101,11 +135,34 @@ Manager::get_min_ts(uint64_t tid) {
 
 void
 Manager::add_ts(ts_t ts) {
-    assert( ts >= *all_ts[_thread_id] ||
-        *all_ts[_thread_id] == UINT64_MAX);
+    assert( ts >= *all_ts[_thread_id] );
     *all_ts[_thread_id] = ts;
 }
 
+void
+Manager::update_node_min_ts(uint64_t node_id, uint64_t ts) {
+    // responses may arrive out of order
+    uint64_t old_ts = _node_min_ts[node_id];
+    while (ts > old_ts && !ATOM_CAS(_node_min_ts[node_id], old_ts, ts))
+        old_ts = _node_min_ts[node_id];
+}
+
+void
+Manager::add_remote_ts(ts_t ts) {
+    pthread_mutex_lock( &_remote_ts_mutex );
+    _remote_ts.insert(ts);
+    pthread_mutex_unlock( &_remote_ts_mutex );
+}
+
+void
+Manager::remove_remote_ts(ts_t ts) {
+    pthread_mutex_lock( &_remote_ts_mutex );
+    auto it = _remote_ts.find(ts);
+    assert(it != _remote_ts.end());
+    _remote_ts.erase(it);
+    pthread_mutex_unlock( &_remote_ts_mutex );
+}
+
 void Manager::set_txn_man(TxnManager * txn) {
     assert(false);
 }
@@ -240,3 +297,26 @@ Manager::failure_protocol() {
 
 }
 
+void
+Manager::inject_failure() {
+    // from now on, the node neither logs nor sends requests, and the other
+    // nodes are answered as by a failed node (see processAsFailed). It
+    // still takes part in the end synchronization, so that the others can
+    // finish the run, and then exits.
+    active = false;
+    cout << "[Sundial] node-" << g_node_id << " fails" << endl;
+#if DISTRIBUTED
+    SundialRequest request;
+    SundialResponse response;
+    request.set_request_type( SundialRequest::SYS_REQ );
+    for (uint32_t i = 0; i < g_num_nodes; i ++) {
+        if (i == g_node_id) continue;
+        rpc_client->sendRequest(i, request, response);
+    }
+    while (!are_all_remote_nodes_done())
+        usleep(1000);
+    // let the replies to the last sync requests go out.
+    sleep(1);
+#endif
+    _exit(0);
+}
@@ -3,7 +3,10 @@
 #include "helper.h"
 #include "global.h"
 #include "rpc_client.h"
+#include "hybrid_clock.h"
+#include "ts_lease.h"
 #include <stack>
+#include <set>
 
 class row_t;
 class TxnManager;
@@ -20,10 +23,21 @@ public:
     // Global timestamp allocation
     uint64_t                get_ts(uint64_t thread_id);
     void                    calibrate_cpu_frequency();
+    // [TS_HLC] the clock value carried by and folded in from every message
+    uint64_t                get_hlc() { return _hlc.latest(); }
+    void                    update_hlc(uint64_t ts) { _hlc.update(ts); }
 
     // For MVCC. To calculate the min active ts in the system
     void                    add_ts(uint64_t ts);
     uint64_t                get_min_ts(uint64_t tid = 0);
+    // snapshots of remote coordinators, read on this node by RPC threads.
+    void                    add_remote_ts(uint64_t ts);
+    void                    remove_remote_ts(uint64_t ts);
+    // no snapshot taken on this node is below the value. It is sent with
+    // every response, so that a node keeps the versions the snapshots of
+    // the others may read there later.
+    uint64_t                get_local_min_ts() { return _local_min_ts; }
+    void                    update_node_min_ts(uint64_t node_id, uint64_t ts);
 
     // For DL_DETECT.
     void                    set_txn_man(TxnManager * txn);
@@ -71,6 +85,8 @@ public:
 
     // Handle Failure
     void                    failure_protocol();
+    // [FAILURE INJECTION] emulate a crash of this node; does not return.
+    void                    inject_failure();
     volatile bool           active;
 
     // For OCC timestamp
@@ -84,6 +100,10 @@ public:
 private:
     pthread_mutex_t         ts_mutex;
     uint64_t *              timestamp;
+    uint64_t                get_hlc_ts();
+    HybridClock             _hlc;
+    // [TS_BATCH_ALLOC] timestamps reserved by the thread (TS_CAS, TS_HLC)
+    static __thread TsLease _ts_lease;
     uint64_t                hash(row_t * row);
     uint64_t volatile * volatile * volatile all_ts;
     TxnManager **           _all_txns;
@@ -106,6 +126,11 @@ private:
     // for MVCC
     volatile uint64_t       _last_min_ts_time;
     uint64_t                _min_ts;
+    volatile uint64_t       _local_min_ts;
+    // latest local min ts received from each node
+    uint64_t volatile *     _node_min_ts;
+    std::multiset<uint64_t> _remote_ts;
+    pthread_mutex_t         _remote_ts_mutex;
 
     pthread_mutex_t *       _worker_pool_mutex;
     uint64_t                _unused_quota;
@@ -37,6 +37,8 @@ void print_usage() {
     printf("\t-CrINT      ; READ_INTENSITY_THRESH\n");
     printf("[Distributed DBMS]:\n");
     printf("\t-Df STRING  ; ifconfig file\n");
+    printf("\t-Dd STRING  ; link delay matrix file\n");
+    printf("\t-Dl STRING  ; local log directory\n");
     printf("\t-DcINT      ; LOCAL_CACHE_SIZE\n");
     printf("\n");
 }
@@ -113,6 +115,10 @@ void parser(int argc, char * argv[]) {
         } else if (argv[i][1] == 'D') {
             if (argv[i][2] == 'f')
                 strcpy( ifconfig_file, argv[++i]);
+            else if (argv[i][2] == 'd')
+                strcpy( delay_matrix_file, argv[++i]);
+            else if (argv[i][2] == 'l')
+                strcpy( log_file_dir, argv[++i]);
             else if (argv[i][2] == 'c')
                 g_local_cache_size = atoi( &argv[i][3] );
             else
@@ -0,0 +1,173 @@
+#include "paxos_log.h"
+#include "manager.h"
+#include "redis_client.h"
+#include "local_log_client.h"
+
+PaxosLog::PaxosLog()
+{
+    pthread_mutex_init(&_latch, NULL);
+    _batch_start_time = 0;
+    _entries = new Entry [PAXOS_MAX_INFLIGHT];
+    for (uint32_t i = 0; i < PAXOS_MAX_INFLIGHT; i++) {
+        _entries[i].index = 0;
+        _entries[i].pending = 0;
+        _entries[i].failed = false;
+        _entries[i].requests.resize(g_num_storage_nodes);
+        _entries[i].responses.resize(g_num_storage_nodes);
+    }
+    _next_index = 0;
+    _commit_index = 0;
+    for (uint32_t i = 0; i < g_num_storage_nodes; i++) {
+        if (i == g_node_id)
+            continue;
+        // XXX(zhihan): only send to # quorum of nodes to avoid null ref error
+        if (_peers.size() == g_quorum)
+            break;
+        _peers.push_back(i);
+    }
+    new std::thread(FlushBatches, this);
+}
+
+void
+PaxosLog::append(const SundialRequest * request, std::function<void(bool)> done)
+{
+    SundialRequest record;
+    record.set_txn_id(request->txn_id());
+    record.set_node_id(request->node_id());
+    record.set_txn_state(request->txn_state());
+    record.set_log_data("[LSN] placehold:" + string(request->log_data_size(), 'd'));
+    Entry * entry = NULL;
+    pthread_mutex_lock(&_latch);
+    if (_batch.empty())
+        _batch_start_time = get_sys_clock();
+    _batch.push_back(done);
+    _batch_records.emplace_back();
+    _batch_records.back().Swap(&record);
+    if (_batch.size() >= PAXOS_BATCH_SIZE)
+        entry = seal();
+    pthread_mutex_unlock(&_latch);
+    if (entry)
+        replicate(entry);
+}
+
+PaxosLog::Entry *
+PaxosLog::seal()
+{
+    if (_batch.empty() || _next_index - _commit_index >= PAXOS_MAX_INFLIGHT)
+        return NULL;
+    Entry * entry = &_entries[_next_index % PAXOS_MAX_INFLIGHT];
+    assert(entry->pending == 0 && entry->callbacks.empty());
+    entry->index = _next_index ++;
+    entry->pending = _peers.size() + 1;
+    entry->failed = false;
+    entry->entry.Clear();
+    entry->entry.set_request_type(SundialRequest::PAXOS_REPLICATE);
+    entry->entry.set_node_id(g_node_id);
+    entry->entry.set_log_index(entry->index);
+    // records that arrived while the pipeline was full wait for the next
+    // entries.
+    size_t num_records = std::min(_batch.size(), (size_t) PAXOS_BATCH_SIZE);
+    for (size_t i = 0; i < num_records; i++)
+        entry->entry.add_batch()->Swap(&_batch_records[i]);
+    entry->callbacks.assign(_batch.begin(), _batch.begin() + num_records);
+    _batch.erase(_batch.begin(), _batch.begin() + num_records);
+    _batch_records.erase(_batch_records.begin(),
+                         _batch_records.begin() + num_records);
+    INC_INT_STATS(num_paxos_entries, 1);
+    INC_INT_STATS(num_paxos_records, entry->callbacks.size());
+    return entry;
+}
+
+void
+PaxosLog::replicate(Entry * entry)
+{
+    // fields of the entry are stable until all of its acks are received.
+    uint64_t index = entry->index;
+    for (auto i : _peers) {
+        SundialRequest &request = entry->requests[i];
+        request = entry->entry;
+        // a peer that was not sent the entry cannot accept it. Sends only
+        // fail once the system shuts down, so the entry is failed rather
+        // than retried.
+        if (rpc_client->sendRequestAsync(nullptr, i, request,
+                                         entry->responses[i], true) != RCOK)
+            ack(index, false);
+    }
+    if (accept(entry->entry, [this, index]() { ack(index); }) != RCOK)
+        ack(index, false);
+}
+
+RC
+PaxosLog::accept(const SundialRequest &entry, std::function<void()> done)
+{
+    vector<uint64_t> node_ids;
+    vector<uint64_t> txn_ids;
+    vector<int> statuses;
+    for (const auto &record : entry.batch()) {
+        node_ids.push_back(record.node_id());
+        txn_ids.push_back(record.txn_id());
+        statuses.push_back(record.txn_state());
+    }
+    // the log keeps the records only, not the fields of the request.
+    SundialRequest records;
+    *records.mutable_batch() = entry.batch();
+    string data = records.SerializeAsString();
+#if LOG_DEVICE == LOG_DVC_LOCAL_FILE
+    return local_log_client->log_entry_async(entry.node_id(), entry.log_index(),
+        data, node_ids, txn_ids, statuses, done);
+#else
+    return redis_client->log_entry_async(entry.node_id(), entry.log_index(),
+        data, node_ids, txn_ids, statuses, done);
+#endif
+}
+
+void
+PaxosLog::ack(uint64_t index, bool ok)
+{
+    vector<std::pair<std::function<void(bool)>, bool> > resolved;
+    vector<Entry *> sealed;
+    pthread_mutex_lock(&_latch);
+    Entry * entry = &_entries[index % PAXOS_MAX_INFLIGHT];
+    assert(entry->index == index && entry->pending > 0);
+    entry->pending --;
+    if (!ok)
+        entry->failed = true;
+    // resolve in log order, once every replica answered.
+    while (_commit_index < _next_index) {
+        Entry * next = &_entries[_commit_index % PAXOS_MAX_INFLIGHT];
+        if (next->pending > 0)
+            break;
+        if (next->failed)
+            INC_INT_STATS(num_paxos_failed_entries, 1);
+        for (auto &done : next->callbacks)
+            resolved.push_back(std::make_pair(done, !next->failed));
+        next->callbacks.clear();
+        _commit_index ++;
+    }
+    // the pipeline has room again; send what accumulated meanwhile.
+    if (!resolved.empty())
+        while (Entry * next = seal())
+            sealed.push_back(next);
+    pthread_mutex_unlock(&_latch);
+    for (auto &done : resolved)
+        done.first(done.second);
+    for (auto next : sealed)
+        replicate(next);
+}
+
+void
+PaxosLog::FlushBatches(PaxosLog * log)
+{
+    while (true) {
+        usleep(PAXOS_BATCH_TIMEOUT);
+        vector<Entry *> sealed;
+        pthread_mutex_lock(&log->_latch);
+        if (!log->_batch.empty()
+            && get_sys_clock() - log->_batch_start_time >= PAXOS_BATCH_TIMEOUT * 1000UL)
+            while (Entry * entry = log->seal())
+                sealed.push_back(entry);
+        pthread_mutex_unlock(&log->_latch);
+        for (auto entry : sealed)
+            log->replicate(entry);
+    }
+}
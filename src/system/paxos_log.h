@@ -0,0 +1,65 @@
+#pragma once
+
+#include <functional>
+#include "global.h"
+#include "rpc_client.h"
+
+// Multi-Paxos log of a storage node acting as the (fixed) leader for the
+// PAXOS_LOG requests it receives.
+// Records are not replicated one by one. They are grouped into log entries of
+// up to PAXOS_BATCH_SIZE records (or whatever arrived within
+// PAXOS_BATCH_TIMEOUT), and up to PAXOS_MAX_INFLIGHT entries are replicated
+// at the same time. An entry is accepted once it is written locally and
+// acknowledged by the peers; entries commit in log order, and the records of
+// a committed entry are acknowledged to their senders.
+class PaxosLog
+{
+public:
+    PaxosLog();
+
+    // log the record of a PAXOS_LOG request. done(true) runs once the entry
+    // holding the record commits, done(false) if the entry failed.
+    void        append(const SundialRequest * request,
+                       std::function<void(bool)> done);
+    // the local write or a peer accepted the entry at index, or failed to
+    // (ok = false). A failed entry is left as a hole in the log: its records
+    // fail, and the entries after it still commit.
+    void        ack(uint64_t index, bool ok = true);
+    // write the entry of a PAXOS_REPLICATE request on this replica and apply
+    // its records, i.e., set the status of their txns. done() runs once both
+    // are durable.
+    static RC   accept(const SundialRequest &entry, std::function<void()> done);
+    // seal the open batch once it waited PAXOS_BATCH_TIMEOUT.
+    static void FlushBatches(PaxosLog * log);
+
+private:
+    struct Entry {
+        uint64_t                            index;
+        // acks still missing (peers and the local write)
+        uint32_t                            pending;
+        // a replica could not accept the entry
+        bool                                failed;
+        // the PAXOS_REPLICATE request; the records are in its batch.
+        SundialRequest                      entry;
+        vector<std::function<void(bool)> >  callbacks;
+        vector<SundialRequest>              requests;
+        vector<SundialResponse>             responses;
+    };
+    // turn the first PAXOS_BATCH_SIZE records of the open batch into the next
+    // entry if the pipeline has room.
+    // Called with _latch held; returns NULL if nothing was sealed.
+    Entry *     seal();
+    void        replicate(Entry * entry);
+
+    pthread_mutex_t                 _latch;
+    // records not yet in an entry
+    vector<std::function<void(bool)> > _batch;
+    vector<SundialRequest>          _batch_records;
+    uint64_t                        _batch_start_time;
+    // ring of the entries being replicated
+    Entry *                         _entries;
+    uint64_t                        _next_index;
+    // entries below _commit_index are committed
+    uint64_t                        _commit_index;
+    vector<uint32_t>                _peers;
+};
@@ -27,6 +27,12 @@ public:
 
     Isolation     get_isolation_level() { return _isolation_level; }
     virtual bool        is_all_remote_readonly() { return false; }
+    // the query only reads, known before execution.
+    virtual bool        is_read_only() { return false; }
+    // (table_id, key) of the local rows the query reads / writes, if known
+    // before execution.
+    virtual void        get_read_keys(std::vector<std::pair<uint32_t, uint64_t> > &keys) {}
+    virtual void        get_write_keys(std::vector<std::pair<uint32_t, uint64_t> > &keys) {}
 #if CC_ALG == WAIT_DIE || CC_ALG == F_ONE || (CC_ALG == TICTOC && OCC_LOCK_TYPE == WAIT_DIE)
     uint64_t     get_ts() { return _txn_ts; }
     void         set_ts(uint64_t txn_ts) { _txn_ts = txn_ts; }
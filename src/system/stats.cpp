@@ -233,6 +233,7 @@ void Stats::output(std::ostream * os)
 
     // debug remote log latency
     STAT_PRINT_AVG_US(double, log_if_ne, float, num_log_if_ne);
+    STAT_PRINT_AVG_US(double, log_if_ne_batch, float, num_log_if_ne_batch);
     STAT_PRINT_AVG_US(double, log_if_ne_data, float, num_log_if_ne_data);
     STAT_PRINT_AVG_US(double, log_if_ne_iso, float, num_log_if_ne_iso);
     STAT_PRINT_AVG_US(double, log_if_ne_data_iso, float, num_log_if_ne_data_iso);
@@ -244,6 +245,16 @@ void Stats::output(std::ostream * os)
     STAT_PRINT_AVG_US(double, log_async_data_iso, float, num_log_async_data_iso);
 
     STAT_PRINT_AVG_US(double, terminate_time, float, num_affected_txn);
+    STAT_SUM(double, total_time_unblock, _float_stats[STAT_time_unblock]);
+    if (total_num_affected_txn > 0)
+        out << "    " << left << "average_time_unblock: " <<
+        total_time_unblock / total_num_affected_txn / 1000 << endl;
+    // user-visible commit latency vs. time until the locks are released
+    STAT_PRINT_AVG_US(double, early_ack_latency, float, num_early_acks);
+    STAT_SUM(double, total_release_latency, _float_stats[STAT_release_latency]);
+    if (total_num_early_acks > 0)
+        out << "    " << left << "average_release_latency: " <<
+        total_release_latency / total_num_early_acks / 1000 << endl;
 
     STAT_SUM(uint64_t, total_prepare, _int_stats[STAT_num_prepare]);
     STAT_SUM(double, total_node_communicate, _float_stats[STAT_time_rpc]);
@@ -314,6 +325,11 @@ void Stats::output(std::ostream * os)
         out << "    " << setw(30) << left << statsIntName[i] + ':'<< total << endl;
 
     }
+    // tuple payloads copied into or out of messages by this node
+    STAT_SUM(uint64_t, total_tuple_bytes_copied, _int_stats[STAT_num_tuple_bytes_copied]);
+    if (total_num_multi_part_txns != 0)
+        out << "    " << setw(30) << left << "average_tuple_bytes_copied:"
+            << total_tuple_bytes_copied * 1.0 / total_num_multi_part_txns << endl;
 #if WORKLOAD == TPCC
     out << "TPCC Per Txn Type Commits/Aborts" << endl;
     out << "    " << setw(18) << left << "Txn Name"
@@ -62,6 +62,12 @@ enum StatsFloat {
 
     // termination time
     STAT_terminate_time,
+    // from the last heartbeat of a failed node to the termination of a txn
+    // blocked on it
+    STAT_time_unblock,
+    // [EARLY CLIENT ACK] from the start of the txn
+    STAT_early_ack_latency,
+    STAT_release_latency,
 
     STAT_log_ready_time,
     STAT_dependency_ready_time,
@@ -84,6 +90,7 @@ enum StatsFloat {
     STAT_time_debug7,
 
     STAT_log_if_ne,
+    STAT_log_if_ne_batch,
     STAT_log_if_ne_iso,
     STAT_log_if_ne_data,
     STAT_log_if_ne_data_iso,
@@ -166,6 +173,7 @@ enum StatsInt {
 
     // remote logging
     STAT_num_log_if_ne,
+    STAT_num_log_if_ne_batch,
     STAT_num_log_if_ne_iso,
     STAT_num_log_if_ne_data,
     STAT_num_log_if_ne_data_iso,
@@ -176,6 +184,34 @@ enum StatsInt {
     STAT_num_log_async_data,
     STAT_num_log_async_data_iso,
 
+    // MVCC
+    STAT_num_mvcc_read_waits,
+    STAT_num_mvcc_rts_aborts,
+    STAT_num_mvcc_gc_versions,
+
+    // hot key tracking
+    STAT_num_hot_key_samples,
+    STAT_num_hot_key_merges,
+    STAT_num_hot_keys,
+    STAT_num_hot_key_batched,
+    STAT_num_det_epochs,
+    STAT_num_rpc_batches,
+    STAT_num_rpc_batched_reqs,
+    STAT_num_paxos_entries,
+    STAT_num_paxos_records,
+    STAT_num_paxos_failed_entries,
+    STAT_num_tuple_bytes_copied,
+    STAT_num_log_group_commits,
+    STAT_num_log_group_records,
+    STAT_num_log_blob_rollovers,
+    STAT_num_log_status_lookups,
+    STAT_num_lazy_log_batches,
+    STAT_num_lazy_log_records,
+    STAT_num_suspected_nodes,
+    STAT_num_blocked_txns,
+    STAT_num_prepare_skipped,
+    STAT_num_early_acks,
+
     NUM_INT_STATS
 };
 
@@ -287,6 +323,9 @@ public:
     
 		// termination time
     	"terminate_time",
+        "time_unblock",
+        "early_ack_latency",
+        "release_latency",
 
         "log_ready_time",
         "dependency_ready_time",
@@ -309,6 +348,7 @@ public:
 
         // remote logging
         "log_if_ne",
+        "log_if_ne_batch",
         "log_if_ne_iso",
         "log_if_ne_data",
         "log_if_ne_data_iso",
@@ -384,10 +424,11 @@ public:
         "int_aborts_ws1",
         "int_aborts_ws2",
 
-        "int_saved_by_hist"
+        "int_saved_by_hist",
 
         // remote logging
         "num_log_if_ne",
+        "num_log_if_ne_batch",
         "num_log_if_ne_iso",
         "num_log_if_ne_data",
         "num_log_if_ne_data_iso",
@@ -398,6 +439,33 @@ public:
         "num_log_async_data",
         "num_log_async_data_iso",
 
+        // MVCC
+        "num_mvcc_read_waits",
+        "num_mvcc_rts_aborts",
+        "num_mvcc_gc_versions",
+
+        // hot key tracking
+        "num_hot_key_samples",
+        "num_hot_key_merges",
+        "num_hot_keys",
+        "num_hot_key_batched",
+        "num_det_epochs",
+        "num_rpc_batches",
+        "num_rpc_batched_reqs",
+        "num_paxos_entries",
+        "num_paxos_records",
+        "num_paxos_failed_entries",
+        "num_tuple_bytes_copied",
+        "num_log_group_commits",
+        "num_log_group_records",
+        "num_log_blob_rollovers",
+        "num_log_status_lookups",
+        "num_lazy_log_batches",
+        "num_lazy_log_records",
+        "num_suspected_nodes",
+        "num_blocked_txns",
+        "num_prepare_skipped",
+        "num_early_acks",
     };
 private:
     vector<double> _aggregate_latency;
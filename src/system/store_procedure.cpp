@@ -11,6 +11,7 @@
 
 StoreProcedure::~StoreProcedure()
 {
+    clear_remote_requests();
     delete _query;
 }
 
@@ -55,6 +56,35 @@ StoreProcedure::incr_local_write() {
 	_txn->num_local_write++;
 }
 
+void
+StoreProcedure::add_remote_request(uint64_t node_id, uint64_t key, uint64_t index_id,
+                                   uint64_t table_id, access_t access_type)
+{
+    vector<RemoteRequestInfo *> &requests = remote_requests[node_id];
+    for (auto req : requests) {
+        if (req->key == key && req->table_id == table_id) {
+            if (access_type != RD)
+                req->access_type = access_type;
+            return;
+        }
+    }
+    RemoteRequestInfo * remote_request = new RemoteRequestInfo;
+    remote_request->key = key;
+    remote_request->index_id = index_id;
+    remote_request->table_id = table_id;
+    remote_request->access_type = access_type;
+    requests.push_back(remote_request);
+}
+
+void
+StoreProcedure::clear_remote_requests()
+{
+    for (auto &it : remote_requests)
+        for (auto req : it.second)
+            delete req;
+    remote_requests.clear();
+}
+
 /*
 RC
 StoreProcedure::process_remote_req(uint32_t size, char * data, uint32_t &resp_size, char * &resp_data)
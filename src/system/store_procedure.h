@@ -37,6 +37,11 @@ public:
     //bool is_single_partition() { return _is_single_partition; }
 
     void incr_local_write();
+    // queue a read of a remote row for the next send_remote_package(). A key
+    // already queued for the node is sent once, with the stronger access type.
+    void add_remote_request(uint64_t node_id, uint64_t key, uint64_t index_id,
+                            uint64_t table_id, access_t access_type);
+    void clear_remote_requests();
 
 protected:
 #define LOAD_VALUE(type, var, schema, data, col) \
@@ -25,11 +25,13 @@
 #include "row_lock.h"
 #endif
 #include "redis_client.h"
+#include "local_log_client.h"
 #include "azure_blob_client.h"
 
 // TODO. cleanup the accesses related malloc code.
 
 TxnManager::TxnManager(QueryBase * query, WorkerThread * thread)
+    : _arena(arena_options(_arena_block, TXN_ARENA_SIZE))
 {
     _store_procedure = GET_WORKLOAD->create_store_procedure(this, query);
     _cc_manager = CCManager::create(this);
@@ -51,6 +53,7 @@ TxnManager::TxnManager(QueryBase * query, WorkerThread * thread)
     _is_txn_read_only = true;
     _is_remote_abort = false;
     _is_coordinator = false;
+    _is_async_commit = false;
 
     dependency_semaphore = new SemaphoreSync();
     rpc_semaphore = new SemaphoreSync();
@@ -60,6 +63,10 @@ TxnManager::TxnManager(QueryBase * query, WorkerThread * thread)
     for (size_t i = 0; i < g_num_nodes; i++) {
         replied_acceptors[i] = 0;
     }
+    for (size_t i = 0; i < NUM_STORAGE_NODES; i++) {
+        txn_requests_[i] = google::protobuf::Arena::CreateMessage<SundialRequest>(&_arena);
+        txn_responses_[i] = google::protobuf::Arena::CreateMessage<SundialResponse>(&_arena);
+    }
 }
 
 TxnManager::~TxnManager()
@@ -67,10 +74,7 @@ TxnManager::~TxnManager()
     if (_store_procedure)
         delete _store_procedure;
     delete _cc_manager;
-    for (auto kvp : _remote_nodes_involved)
-        delete kvp.second;
-    for (auto kvp : _log_nodes_involved)
-        delete kvp.second;
+    // RemoteNodeInfo and all messages are freed with _arena.
     delete dependency_semaphore;
     delete rpc_semaphore;
     delete rpc_log_semaphore;
@@ -104,9 +108,10 @@ TxnManager::update_stats()
         } else {
             INC_FLOAT_STATS(multi_part_execute_phase, _prepare_start_time - _txn_restart_time);
             INC_FLOAT_STATS(multi_part_prepare_phase, _commit_start_time - _prepare_start_time);
-            INC_FLOAT_STATS(multi_part_commit_phase, _finish_time - _commit_start_time);
+            // time the worker spends in the commit phase, incl. the acks
+            INC_FLOAT_STATS(multi_part_commit_phase, _commit_end_time - _commit_start_time);
             INC_FLOAT_STATS(multi_part_abort, _txn_restart_time - _txn_start_time);
-            INC_FLOAT_STATS(multi_part_cleanup_phase, get_sys_clock() - _finish_time);
+            INC_FLOAT_STATS(multi_part_cleanup_phase, get_sys_clock() - _commit_end_time);
 
             INC_INT_STATS(num_multi_part_txn, 1);
             latency = _finish_time - _txn_start_time;
@@ -156,15 +161,43 @@ TxnManager::restart() {
 
     _txn_restart_time = get_sys_clock();
     _store_procedure->init();
-    for (auto kvp : _remote_nodes_involved)
-        delete kvp.second;
-    _remote_nodes_involved.clear();
-    for (auto kvp : _log_nodes_involved)
-        delete kvp.second;
-    _log_nodes_involved.clear();
+    free_remote_node_infos(_remote_nodes_involved);
+    free_remote_node_infos(_log_nodes_involved);
     return start();
 }
 
+void
+TxnManager::release_async_commit()
+{
+    assert(_is_async_commit);
+    if (rpc_semaphore->decr() == 0) {
+        txn_table->remove_txn(this);
+        delete this;
+    }
+}
+
+TxnManager::RemoteNodeInfo *
+TxnManager::new_remote_node_info()
+{
+    if (_free_node_infos.empty())
+        return google::protobuf::Arena::Create<RemoteNodeInfo>(&_arena, &_arena);
+    RemoteNodeInfo * info = _free_node_infos.back();
+    _free_node_infos.pop_back();
+    info->state = RUNNING;
+    info->is_readonly = true;
+    info->request.Clear();
+    info->response.Clear();
+    return info;
+}
+
+void
+TxnManager::free_remote_node_infos(std::map<uint32_t, RemoteNodeInfo *> &infos)
+{
+    for (auto kvp : infos)
+        _free_node_infos.push_back(kvp.second);
+    infos.clear();
+}
+
 RC
 TxnManager::start()
 {
@@ -173,6 +206,12 @@ TxnManager::start()
     _is_coordinator = true;
     // running transaction on the host node
     rc = _store_procedure->execute();
+#if PIPELINED_REMOTE_READS
+    // a procedure that aborted early has not waited for its remote reads.
+    if (!_pending_read_nodes.empty() && wait_remote_package() == ABORT
+        && rc == COMMIT)
+        rc = ABORT;
+#endif
     // TODO: used by occ, but may overlap with tictoc's method
     if (rc == COMMIT)
         rc = _cc_manager->validate();
@@ -188,6 +227,7 @@ TxnManager::start()
         if (rc != FAIL) {
             _commit_start_time = get_sys_clock();
             rc = process_2pc_phase2(rc);
+            _commit_end_time = get_sys_clock();
         }
     }
     if (rc != FAIL) {
@@ -201,32 +241,100 @@ TxnManager::start()
 
 RC
 TxnManager::termination_protocol() {
+    // received msg from failed node, need to learn the decision or force abort
+    // possible return values: COMMIT, ABORT, FAIL(self is down)
+    if (start_termination() == FAIL)
+        return FAIL;
+    rpc_log_semaphore->wait();
+    return _decision;
+}
+
+RC
+TxnManager::start_termination(std::map<uint64_t, vector<TxnManager *> > * lookups) {
 #if DEBUG_FAILURE || DEBUG_PRINT
 	printf("[node-%u, txn-%lu] termination protocol\n", g_node_id, _txn_id);
 #endif
-    // received msg from failed node, need to learn the decision or force abort
-    // possible return values: COMMIT, ABORT, FAIL(self is down)
 	_decision = COMMIT;
     _terminate_time = get_sys_clock();
-    for (auto it = _remote_nodes_involved.begin(); it != _remote_nodes_involved.end(); it ++) {
-        if (it->second->is_readonly)
-            continue;
+    vector<uint64_t> logs;
+    if (_txn_state == RUNNING) {
+        // self has not voted yes. The abort is logged first, so that whoever
+        // reads our log for the txn learns the same outcome.
+        _decision = ABORT;
+        logs.push_back(g_node_id);
+    } else {
+        for (auto it = _remote_nodes_involved.begin();
+             it != _remote_nodes_involved.end(); it ++)
+            if (!it->second->is_readonly)
+                logs.push_back(it->first);
+    }
+    for (auto node_id : logs) {
         rpc_log_semaphore->incr();
+        if (lookups) {
+            (*lookups)[node_id].push_back(this);
+            continue;
+        }
 #if LOG_DEVICE == LOG_DVC_REDIS
-        if (redis_client->log_if_ne(it->first, get_txn_id()) == FAIL) {
+        if (redis_client->log_if_ne(node_id, get_txn_id()) == FAIL) {
+            // self if fail, stop working and return
+            _decision = FAIL;
+            return FAIL;
+        }
+#elif LOG_DEVICE == LOG_DVC_LOCAL_FILE
+        if (local_log_client->log_if_ne(node_id, get_txn_id()) == FAIL) {
             // self if fail, stop working and return
             _decision = FAIL;
             return FAIL;
         }
 #elif LOG_DEVICE == LOG_DVC_AZURE_BLOB
-        if (azure_blob_client->log_if_ne(it->first, get_txn_id()) == FAIL) {
+        if (azure_blob_client->log_if_ne(node_id, get_txn_id()) == FAIL) {
             // self if fail, stop working and return
             _decision = FAIL;
             return FAIL;
         }
 #endif
     }
-    rpc_log_semaphore->wait();
-    return _decision;
+    return RCOK;
+}
+
+void
+TxnManager::resolve_termination(State state) {
+    // default is commit, only need to set abort or committed
+    if (state == ABORTED) {
+        _decision = ABORT;
+    } else if (state == COMMITTED) {
+        _decision = COMMIT;
+    } else if (state != PREPARED) {
+        assert(false);
+    }
+    // mark as returned.
+    rpc_log_semaphore->decr();
+}
+
+RC
+TxnManager::finish_termination() {
+    if (_decision != FAIL)
+        rpc_log_semaphore->wait();
+    RC rc = _decision;
+    // a running sub-txn never voted, so its own log can only hold the abort.
+    assert(_txn_state == PREPARED || rc != COMMIT);
+    if (_txn_state == PREPARED && rc != FAIL) {
+        // log the decision as a decision request would
+        log_status_async(rc_to_state(rc));
+        rpc_log_semaphore->wait();
+    }
+    _cc_manager->cleanup(rc == COMMIT? COMMIT : ABORT);
+    _txn_state = (rc == COMMIT)? COMMITTED : ABORTED;
+#if DEBUG_FAILURE || DEBUG_PRINT
+    printf("[node-%u, txn-%lu] terminated: %s\n", g_node_id, _txn_id,
+           rc == COMMIT? "commit" : "abort");
+#endif
+    uint64_t term_time = get_sys_clock() - _terminate_time;
+    INC_FLOAT_STATS(terminate_time, term_time);
+    INC_INT_STATS(num_affected_txn, 1);
+#if COLLECT_LATENCY
+    glob_stats->_stats[GET_THD_ID]->term_latency.push_back(term_time);
+#endif
+    return rc;
 }
 
@@ -55,6 +55,11 @@ public:
     void              set_decision(RC rc) { _decision = rc; };
     void              lock() {pthread_mutex_lock(&_latch);};
     void              unlock() {pthread_mutex_unlock(&_latch);}
+    // [ASYNC COMMIT] the commit acks are still in flight. The worker and each
+    // ack hold a count on rpc_semaphore; whoever drops the last one removes
+    // the txn from the txn_table and deletes it.
+    bool              is_async_commit()     { return _is_async_commit; }
+    void              release_async_commit();
 
     // Synchronization
     // ===============
@@ -71,6 +76,10 @@ public:
     RC send_remote_read_request(uint64_t node_id, uint64_t key, uint64_t index_id,
                                 uint64_t table_id, access_t access_type);
     RC send_remote_package(std::map<uint64_t, vector<RemoteRequestInfo *> > &remote_requests);
+    // [PIPELINED READS] send_remote_package() split in two: send the reads,
+    // then wait for all reads sent so far and process their responses.
+    RC send_remote_package_async(std::map<uint64_t, vector<RemoteRequestInfo *> > &remote_requests);
+    RC wait_remote_package();
     RC process_2pc_phase1();
     RC process_2pc_phase2(RC rc);
     // server
@@ -84,6 +93,16 @@ public:
     RC process_terminate_request(const SundialRequest* request, SundialResponse*
     response);
     RC termination_protocol();
+    // [FAILURE DETECTOR] termination_protocol() split in two, so that the
+    // terminations of many txns overlap: send the log_if_ne requests, then
+    // wait for them and apply the decision. A txn that has not voted yet is
+    // aborted, after the abort is written to its own log through log_if_ne.
+    // With lookups, the log_if_ne requests are not sent but added to
+    // lookups[node] for the caller to send as batches; each result is passed
+    // to resolve_termination().
+    RC start_termination(std::map<uint64_t, vector<TxnManager *> > * lookups = NULL);
+    RC finish_termination();
+    void resolve_termination(State state);
     void handle_prepare_resp(SundialResponse::ResponseType response, uint32_t
     node_id);
 
@@ -121,6 +140,7 @@ private:
     bool              _is_txn_read_only;
     bool              _is_remote_abort;
     bool              _is_coordinator;
+    bool              _is_async_commit;
     // txn_id format.
     // | per thread monotonically increasing ID   |  thread ID   |   Node ID |
     uint64_t          _txn_id;
@@ -133,13 +153,24 @@ private:
 
     bool              _is_sub_txn;
     struct RemoteNodeInfo {
+        RemoteNodeInfo(google::protobuf::Arena * arena) :
+            state(RUNNING), is_readonly(true),
+            request(*google::protobuf::Arena::CreateMessage<SundialRequest>(arena)),
+            response(*google::protobuf::Arena::CreateMessage<SundialResponse>(arena)) {};
         volatile State state;
         bool is_readonly;
         // At any point in time, a remote node has at most 1 request and 1
         // response.
-        SundialRequest request;
-        SundialResponse response;
+        SundialRequest &request;
+        SundialResponse &response;
     };
+    // RemoteNodeInfo and its messages live on _arena. Infos dropped by a
+    // restart are kept in _free_node_infos and reused.
+    RemoteNodeInfo *  new_remote_node_info();
+    void              free_remote_node_infos(std::map<uint32_t, RemoteNodeInfo *> &infos);
+    vector<RemoteNodeInfo *> _free_node_infos;
+    // nodes whose read responses are not processed yet
+    vector<uint64_t>  _pending_read_nodes;
 
     // used for native remote log
     std::map<uint32_t, RemoteNodeInfo *> _log_nodes_involved;
@@ -150,6 +181,8 @@ private:
     uint64_t          _txn_restart_time;
     uint64_t          _prepare_start_time;
     uint64_t          _commit_start_time;
+    // the worker leaves the commit phase
+    uint64_t          _commit_end_time;
     uint64_t          _log_ready_time;
     uint64_t          _precommit_finish_time;
     uint64_t          _finish_time;
@@ -170,18 +203,20 @@ private:
             (std::memory_order_relaxed);}
     void increment_replied_acceptors(size_t i) { replied_acceptors[i]++; }
     void increment_replied_acceptors2() { replied_acceptors2++; }
-    void sendReplicateRequest(State state, uint64_t log_data_size);
 
-    // txn level requests
-    // request in phase 1, as leader of paxos
-    SundialRequest txn_requests_[NUM_STORAGE_NODES];
-    SundialResponse txn_responses_[NUM_STORAGE_NODES];
-
-    // request in phase 2, as leader of paxos
-    SundialRequest txn_requests2_[NUM_STORAGE_NODES];
-    SundialResponse txn_responses2_[NUM_STORAGE_NODES];
+    // txn level requests, as leader of paxos. Allocated on _arena.
+    SundialRequest * txn_requests_[NUM_STORAGE_NODES];
+    SundialResponse * txn_responses_[NUM_STORAGE_NODES];
 
   private:
+    // log the status (and data) of the txn on this node; decrements
+    // rpc_log_semaphore once it is durable.
+    void log_status_async(State status, string * data = NULL);
+#if COMMIT_ALG == ONE_PC && EARLY_CLIENT_ACK
+    // [EARLY CLIENT ACK] log the commit decision; the txn is cleaned up once
+    // it is durable.
+    void log_early_ack_decision();
+#endif
     void sendRemoteLogRequest(State state, uint64_t log_data_size,
                               uint32_t coord_id=0,
                               SundialRequest::ResponseType
@@ -195,4 +230,9 @@ private:
     std::atomic<int> replied_acceptors[NUM_NODES];
     std::atomic<int> replied_acceptors2;
     uint64_t thd_id;
+
+    // all protobuf messages of the txn are allocated here and freed at once
+    // with the txn. The first block is part of the TxnManager itself.
+    char              _arena_block[TXN_ARENA_SIZE];
+    google::protobuf::Arena _arena;
 };
@@ -26,11 +26,20 @@
 #include "lock_manager.h"
 #include "f1_manager.h"
 #include "occ_manager.h"
+#include "mvcc_manager.h"
+#include "maat_manager.h"
 #if CC_ALG == NO_WAIT || CC_ALG == WAIT_DIE
 #include "row_lock.h"
 #endif
 #include "redis_client.h"
+#include "local_log_client.h"
 #include "azure_blob_client.h"
+#include "lazy_log.h"
+
+// with presumed abort, the coordinator writes no prepare record. Its data is
+// logged with the commit decision, and an abort is not logged at all.
+#define COORD_LOGS_PREPARE (COMMIT_ALG != COORDINATOR_LOG && \
+    !(COMMIT_ALG == TWO_PC && TWO_PC_PRESUME == PRESUME_ABORT))
 
 
 RC
@@ -48,9 +57,13 @@ TxnManager::process_commit_phase_singlepart(RC rc)
     dependency_semaphore->wait();
 #endif
     // if logging didn't happen, process commit phase
-    if (!is_read_only()) {
+    // in deterministic mode, the input of the epoch is already logged and
+    // replaying it reproduces the outcome of the txn.
+    if (!is_read_only() && !DETERMINISTIC) {
     #if LOG_DEVICE == LOG_DVC_REDIS
        redis_client->log_sync_data(g_node_id, get_txn_id(), rc_to_state(rc), data);
+    #elif LOG_DEVICE == LOG_DVC_LOCAL_FILE
+       local_log_client->log_sync_data(g_node_id, get_txn_id(), rc_to_state(rc), data);
     #elif LOG_DEVICE == LOG_DVC_AZURE_BLOB
        azure_blob_client->log_sync_data(g_node_id, get_txn_id(), rc_to_state(rc),
            data);
@@ -74,6 +87,15 @@ TxnManager::process_2pc_phase1()
 {
     // Start Two-Phase Commit
     _decision = COMMIT;
+#if SKIP_READONLY_PREPARE
+    // the participants already ended their sub-txns (see
+    // process_read_request), and reads from the snapshot need no validation.
+    if (_store_procedure->get_query()->is_read_only()) {
+        assert(is_read_only() && is_txn_read_only());
+        INC_INT_STATS(num_prepare_skipped, 1);
+        return COMMIT;
+    }
+#endif
 
 #if EARLY_LOCK_RELEASE
     _cc_manager->retire(); // release lock after log is received
@@ -81,13 +103,15 @@ TxnManager::process_2pc_phase1()
 #endif
 
     // if the entire txn is read-write, log to remote storage
-    if (!is_txn_read_only() && COMMIT_ALG != COORDINATOR_LOG) {
+    if (!is_txn_read_only() && COORD_LOGS_PREPARE) {
         string data = "[LSN] placehold:" + string(num_local_write *
                 g_log_sz * 8, 'd');
         rpc_log_semaphore->incr();
     #if COMMIT_ALG == ONE_PC
         #if LOG_DEVICE == LOG_DVC_REDIS
         redis_client->log_if_ne_data(g_node_id, get_txn_id(), data);
+        #elif LOG_DEVICE == LOG_DVC_LOCAL_FILE
+        local_log_client->log_if_ne_data(g_node_id, get_txn_id(), data);
         #elif LOG_DEVICE == LOG_DVC_AZURE_BLOB
         azure_blob_client->log_if_ne_data(g_node_id, get_txn_id(), data);
         #elif LOG_DEVICE == LOG_DVC_CUSTOMIZED
@@ -99,6 +123,8 @@ TxnManager::process_2pc_phase1()
     #else
         #if LOG_DEVICE == LOG_DVC_REDIS
         redis_client->log_async_data(g_node_id, get_txn_id(), PREPARED, data);
+        #elif LOG_DEVICE == LOG_DVC_LOCAL_FILE
+        local_log_client->log_async_data(g_node_id, get_txn_id(), PREPARED, data);
         #elif LOG_DEVICE == LOG_DVC_AZURE_BLOB
         azure_blob_client->log_async_data(g_node_id, get_txn_id(), PREPARED, data);
         #elif LOG_DEVICE == LOG_DVC_CUSTOMIZED
@@ -108,6 +134,11 @@ TxnManager::process_2pc_phase1()
                              g_node_id);
         #endif
     #endif // COMMIT_ALG == ONE_PC
+    #if COMMIT_ALG == TWO_PC && TWO_PC_PRESUME == PRESUME_COMMIT
+        // a txn without a record is presumed committed, so the record listing
+        // the participants is durable before any of them can vote.
+        rpc_log_semaphore->wait();
+    #endif
     }
 
     SundialRequest::NodeData * participant;
@@ -159,11 +190,18 @@ TxnManager::process_2pc_phase1()
 
     // wait for log if the txn is read/write
     // if coodinator log, will wait for data logging in next stage
-    if (!is_txn_read_only() && COMMIT_ALG != COORDINATOR_LOG)
+    if (!is_txn_read_only() && COORD_LOGS_PREPARE)
         rpc_log_semaphore->wait();
 
     // wait for vote
     rpc_semaphore->wait();
+#if CC_ALG == MAAT
+    // intersect the timestamp ranges of all participants
+    for (auto it = _remote_nodes_involved.begin(); it != _remote_nodes_involved.end(); it ++) {
+        if (_decision == COMMIT && it->second->state == PREPARED)
+            _decision = ((CC_MAN *)_cc_manager)->process_prepare_resp(it->second->response);
+    }
+#endif
     _txn_state = PREPARED;
     return _decision;
 }
@@ -198,7 +236,7 @@ RC
 TxnManager::process_2pc_phase2(RC rc)
 {
     bool remote_readonly = is_read_only() && (rc == COMMIT);
-    if (remote_readonly && CC_ALG != OCC) {
+    if (remote_readonly && CC_ALG != OCC && CC_ALG != MAAT) {
         for (auto it = _remote_nodes_involved.begin();
              it != _remote_nodes_involved.end(); it++) {
             if (!(it->second->is_readonly)) {
@@ -214,11 +252,32 @@ TxnManager::process_2pc_phase2(RC rc)
         return rc;
     }
 
-    rpc_log_semaphore->incr();
-    #if COMMIT_ALG == TWO_PC
+    #if COMMIT_ALG == TWO_PC && TWO_PC_PRESUME == PRESUME_ABORT
+        // presumed abort: the commit record is forced, the abort not written.
+        if (rc == COMMIT) {
+            string data = "[LSN] placehold:" + string(num_local_write *
+                                                      g_log_sz * 8, 'd');
+            log_status_async(COMMITTED, is_txn_read_only()? NULL : &data);
+            rpc_log_semaphore->wait();
+        }
+        _finish_time = get_sys_clock();
+    #elif COMMIT_ALG == TWO_PC && TWO_PC_PRESUME == PRESUME_COMMIT
+        // presumed commit: the prepare record of the coordinator lists the
+        // participants, so the commit record is forced and the abort is not.
+        if (rc == COMMIT) {
+            log_status_async(COMMITTED);
+            rpc_log_semaphore->wait();
+        } else {
+            lazy_log->append(get_txn_id(), ABORTED);
+        }
+        _finish_time = get_sys_clock();
+    #elif COMMIT_ALG == TWO_PC
+        rpc_log_semaphore->incr();
         // 2pc: persistent decision
         #if LOG_DEVICE == LOG_DVC_REDIS
         redis_client->log_async(g_node_id, get_txn_id(), rc_to_state(rc));
+        #elif LOG_DEVICE == LOG_DVC_LOCAL_FILE
+        local_log_client->log_async(g_node_id, get_txn_id(), rc_to_state(rc));
         #elif LOG_DEVICE == LOG_DVC_AZURE_BLOB
         azure_blob_client->log_async(g_node_id, get_txn_id(), rc_to_state(rc));
         #elif LOG_DEVICE == LOG_DVC_CUSTOMIZED
@@ -232,18 +291,26 @@ TxnManager::process_2pc_phase2(RC rc)
     #elif COMMIT_ALG == ONE_PC
         // finish before sending out logs.
         _finish_time = get_sys_clock();
-        #if LOG_DEVICE == LOG_DVC_REDIS
-        rpc_log_semaphore->incr();
-        redis_client->log_async(g_node_id, get_txn_id(), rc_to_state(rc);
-        #elif LOG_DEVICE == LOG_DVC_AZURE_BLOB
-        azure_blob_client->log_async(g_node_id, get_txn_id(), rc_to_state(rc));
-        #elif LOG_DEVICE == LOG_DVC_CUSTOMIZED
-        redis_client->log_async(g_node_id, get_txn_id(), rc_to_state(rc));
-        rpc_log_semaphore->wait();
-        sendRemoteLogRequest(rc_to_state(rc), 1, g_node_id,
-                             SundialRequest::RESP_OK);
-        #endif
+        // with an early client ack, all votes are durable and the txn is
+        // committed; its decision is logged once the COMMIT_REQs are out
+        // (see log_early_ack_decision).
+        if (!EARLY_CLIENT_ACK || rc != COMMIT) {
+            rpc_log_semaphore->incr();
+            #if LOG_DEVICE == LOG_DVC_REDIS
+            redis_client->log_async(g_node_id, get_txn_id(), rc_to_state(rc));
+            #elif LOG_DEVICE == LOG_DVC_LOCAL_FILE
+            local_log_client->log_async(g_node_id, get_txn_id(), rc_to_state(rc));
+            #elif LOG_DEVICE == LOG_DVC_AZURE_BLOB
+            azure_blob_client->log_async(g_node_id, get_txn_id(), rc_to_state(rc));
+            #elif LOG_DEVICE == LOG_DVC_CUSTOMIZED
+            redis_client->log_async(g_node_id, get_txn_id(), rc_to_state(rc));
+            rpc_log_semaphore->wait();
+            sendRemoteLogRequest(rc_to_state(rc), 1, g_node_id,
+                                 SundialRequest::RESP_OK);
+            #endif
+        }
     #elif COMMIT_ALG == COORDINATOR_LOG
+        rpc_log_semaphore->incr();
         // log all at once
         data = "[LSN] placehold:" + string(num_local_write * g_log_sz * 8, 'd');
         for (auto it = _remote_nodes_involved.begin();
@@ -255,6 +322,8 @@ TxnManager::process_2pc_phase2(RC rc)
         // 2pc: persistent decision
         #if LOG_DEVICE == LOG_DVC_REDIS
         redis_client->log_async_data(g_node_id, get_txn_id(), rc_to_state(rc), data);
+        #elif LOG_DEVICE == LOG_DVC_LOCAL_FILE
+        local_log_client->log_async_data(g_node_id, get_txn_id(), rc_to_state(rc), data);
         #elif LOG_DEVICE == LOG_DVC_AZURE_BLOB
         azure_blob_client->log_async_data(g_node_id, get_txn_id(), rc_to_state(rc), data);
         #elif LOG_DEVICE == LOG_DVC_CUSTOMIZED
@@ -268,6 +337,13 @@ TxnManager::process_2pc_phase2(RC rc)
     #endif
 
 
+#if ASYNC_COMMIT || EARLY_CLIENT_ACK
+    // the decision is durable. An abort may restart the txn, which reuses its
+    // requests, so only commits skip the acks.
+    _is_async_commit = (rc == COMMIT);
+    if (_is_async_commit)
+        rpc_semaphore->incr(); // held by the worker
+#endif
     for (auto it = _remote_nodes_involved.begin(); it != _remote_nodes_involved.end(); it ++) {
         // No need to run this phase if the remote sub-txn has already committed
         // or aborted.
@@ -284,17 +360,34 @@ TxnManager::process_2pc_phase2(RC rc)
         SundialRequest::RequestType type = (rc == COMMIT)?
             SundialRequest::COMMIT_REQ : SundialRequest::ABORT_REQ;
         request.set_request_type( type );
+#if CC_ALG == MAAT
+        request.set_ts( ((CC_MAN *)_cc_manager)->get_commit_ts() );
+#endif
         rpc_semaphore->incr();
         rpc_client->sendRequestAsync(this, it->first, request, response);
     }
 
+#if COMMIT_ALG == ONE_PC && EARLY_CLIENT_ACK
+    if (rc == COMMIT) {
+        // the client sees the commit here; the locks are released later.
+        _txn_state = COMMITTED;
+        INC_INT_STATS(num_early_acks, 1);
+        INC_FLOAT_STATS(early_ack_latency, _finish_time - _txn_start_time);
+#if DEBUG_FAILURE
+        printf("[node-%u, txn-%lu] early ack\n", g_node_id, get_txn_id());
+#endif
+        log_early_ack_decision();
+        return rc;
+    }
+#endif
     // OPTIMIZATION: release locks as early as possible.
     // No need to wait for this log since it is optional (shared log optimization)
 #if COMMIT_ALG == ONE_PC
     rpc_log_semaphore->wait();
 #endif
     _cc_manager->cleanup(rc);
-    rpc_semaphore->wait();
+    if (!_is_async_commit)
+        rpc_semaphore->wait();
     _txn_state = (rc == COMMIT)? COMMITTED : ABORTED;
     return rc;
 }
@@ -309,7 +402,7 @@ TxnManager::send_remote_read_request(uint64_t node_id, uint64_t key, uint64_t in
 {
     _is_single_partition = false;
     if ( _remote_nodes_involved.find(node_id) == _remote_nodes_involved.end() ) {
-        _remote_nodes_involved[node_id] = new RemoteNodeInfo;
+        _remote_nodes_involved[node_id] = new_remote_node_info();
         _remote_nodes_involved[node_id]->state = RUNNING;
         _remote_nodes_involved[node_id]->is_readonly = true;
     }
@@ -326,6 +419,12 @@ TxnManager::send_remote_read_request(uint64_t node_id, uint64_t key, uint64_t in
     read_request->set_index_id(index_id);
     read_request->set_access_type(access_type);
     request.set_node_id(node_id);
+#if CC_ALG == IDEAL_MVCC
+    request.set_ts( ((CC_MAN *)_cc_manager)->get_ts() );
+#endif
+#if SKIP_READONLY_PREPARE
+    request.set_read_only_txn(_store_procedure->get_query()->is_read_only());
+#endif
     rpc_client->sendRequest(node_id, request, response);
 
     if (access_type != RD) {
@@ -349,19 +448,37 @@ TxnManager::send_remote_read_request(uint64_t node_id, uint64_t key, uint64_t in
 
 RC
 TxnManager::send_remote_package(std::map<uint64_t, vector<RemoteRequestInfo *> > &remote_requests)
+{
+    RC rc = send_remote_package_async(remote_requests);
+    if (rc != RCOK)
+        return rc;
+    return wait_remote_package();
+}
+
+RC
+TxnManager::send_remote_package_async(std::map<uint64_t, vector<RemoteRequestInfo *> > &remote_requests)
 {
     _is_single_partition = false;
     for (auto it = remote_requests.begin(); it != remote_requests.end(); it ++) {
         uint64_t node_id = it->first;
         if ( _remote_nodes_involved.find(node_id) == _remote_nodes_involved.end() ) {
-            _remote_nodes_involved[node_id] = new RemoteNodeInfo;
+            _remote_nodes_involved[node_id] = new_remote_node_info();
             _remote_nodes_involved[node_id]->state = RUNNING;
             _remote_nodes_involved[node_id]->is_readonly = true;
         }
         SundialRequest &request = _remote_nodes_involved[node_id]->request;
+        SundialResponse &response = _remote_nodes_involved[node_id]->response;
+        request.Clear();
+        response.Clear();
         request.set_txn_id( get_txn_id() );
         request.set_node_id( node_id );
         request.set_request_type( SundialRequest::READ_REQ );
+#if CC_ALG == IDEAL_MVCC
+        request.set_ts( ((CC_MAN *)_cc_manager)->get_ts() );
+#endif
+#if SKIP_READONLY_PREPARE
+        request.set_read_only_txn(_store_procedure->get_query()->is_read_only());
+#endif
         for (auto it2 = it->second.begin(); it2 != it->second.end(); it2 ++) {
             SundialRequest::ReadRequest * read_request = request.add_read_requests();
             read_request->set_key((*it2)->key);
@@ -372,30 +489,92 @@ TxnManager::send_remote_package(std::map<uint64_t, vector<RemoteRequestInfo *> >
                 set_txn_read_write();
             }
         }
+        // a node has at most one outstanding request
+        assert(std::find(_pending_read_nodes.begin(), _pending_read_nodes.end(),
+                         node_id) == _pending_read_nodes.end());
+        _pending_read_nodes.push_back(node_id);
     }
 
-    for (auto it = _remote_nodes_involved.begin(); it != _remote_nodes_involved.end(); it ++) {
-        rpc_client->sendRequestAsync(this, it->first, it->second->request,
-            it->second->response);
+    for (auto it = remote_requests.begin(); it != remote_requests.end(); it ++) {
+        RemoteNodeInfo * info = _remote_nodes_involved[it->first];
         rpc_semaphore->incr();
+        rpc_client->sendRequestAsync(this, it->first, info->request,
+            info->response);
     }
+    return RCOK;
+}
+
+RC
+TxnManager::wait_remote_package()
+{
     rpc_semaphore->wait();
     RC rc = RCOK;
-    for (auto it = _remote_nodes_involved.begin(); it != _remote_nodes_involved.end(); it ++) {
-        SundialResponse &response = it->second->response;
+    for (auto node_id : _pending_read_nodes) {
+        SundialResponse &response = _remote_nodes_involved[node_id]->response;
         if (response.response_type() == SundialResponse::RESP_OK) {
-            ((CC_MAN *)_cc_manager)->process_remote_read_response(it->first, response);
+            ((CC_MAN *)_cc_manager)->process_remote_read_response(node_id, response);
         } else if (response.response_type() == SundialResponse::RESP_ABORT) {
-            _remote_nodes_involved[it->first]->state = ABORTED;
+            _remote_nodes_involved[node_id]->state = ABORTED;
             _is_remote_abort = true;
             rc = ABORT;
         } else {
             assert(false);
         }
     }
+    _pending_read_nodes.clear();
     return rc;
 }
 
+void
+TxnManager::log_status_async(State status, string * data)
+{
+    rpc_log_semaphore->incr();
+#if LOG_DEVICE == LOG_DVC_REDIS || LOG_DEVICE == LOG_DVC_CUSTOMIZED
+    if (data)
+        redis_client->log_async_data(g_node_id, get_txn_id(), status, *data);
+    else
+        redis_client->log_async(g_node_id, get_txn_id(), status);
+#elif LOG_DEVICE == LOG_DVC_LOCAL_FILE
+    if (data)
+        local_log_client->log_async_data(g_node_id, get_txn_id(), status, *data);
+    else
+        local_log_client->log_async(g_node_id, get_txn_id(), status);
+#elif LOG_DEVICE == LOG_DVC_AZURE_BLOB
+    if (data)
+        azure_blob_client->log_async_data(g_node_id, get_txn_id(), status, *data);
+    else
+        azure_blob_client->log_async(g_node_id, get_txn_id(), status);
+#endif
+}
+
+#if COMMIT_ALG == ONE_PC && EARLY_CLIENT_ACK
+void
+TxnManager::log_early_ack_decision()
+{
+    // the decision log holds the txn until it is durable; then the txn is
+    // cleaned up and reclaimed with the last COMMIT_REQ ack.
+    rpc_semaphore->incr();
+    vector<uint64_t> txn_ids(1, get_txn_id());
+    vector<int> statuses(1, COMMITTED);
+    std::function<void()> callback = [this]() {
+        _cc_manager->cleanup(COMMIT);
+        INC_FLOAT_STATS(release_latency, get_sys_clock() - _txn_start_time);
+        release_async_commit();
+    };
+    RC rc = RCOK;
+#if LOG_DEVICE == LOG_DVC_REDIS || LOG_DEVICE == LOG_DVC_CUSTOMIZED
+    rc = redis_client->log_async_batch(g_node_id, txn_ids, statuses, callback);
+#elif LOG_DEVICE == LOG_DVC_LOCAL_FILE
+    rc = local_log_client->log_async_batch(g_node_id, txn_ids, statuses, callback);
+#elif LOG_DEVICE == LOG_DVC_AZURE_BLOB
+    rc = azure_blob_client->log_async_batch(g_node_id, txn_ids, statuses, callback);
+#endif
+    // not logged if the system is shutting down; the callback never runs.
+    if (rc == FAIL)
+        callback();
+}
+#endif
+
 void TxnManager::sendRemoteLogRequest(State state, uint64_t log_data_size,
                                       uint32_t coord_id,
                                       SundialRequest::ResponseType
@@ -428,8 +607,8 @@ void TxnManager::sendRemoteLogRequest(State state, uint64_t log_data_size,
         rpc_log_semaphore->incr();
         rpc_client->sendRequestAsync(this, node_id, request, response, true);
     } else {
-        SundialRequest &request = txn_requests_[node_id];
-        SundialResponse &response = txn_responses_[node_id];
+        SundialRequest &request = *txn_requests_[node_id];
+        SundialResponse &response = *txn_responses_[node_id];
         request.set_request_type(SundialRequest::PAXOS_LOG);
         request.set_txn_id(get_txn_id());
         request.set_coord_id(coord_id);
@@ -451,26 +630,26 @@ void TxnManager::sendRemoteLogRequest(State state, uint64_t log_data_size,
         if (sent == g_quorum)
             break;
         rpc_log_semaphore->incr();
-        txn_requests_[i].set_request_type
+        txn_requests_[i]->set_request_type
           (SundialRequest::PAXOS_LOG_COLOCATE);
-        txn_requests_[i].set_txn_id(get_txn_id());
-        txn_requests_[i].set_log_data_size(log_data_size);
-        txn_requests_[i].set_txn_state(state);
-        txn_requests_[i].set_semaphore(reinterpret_cast<uint64_t>
+        txn_requests_[i]->set_txn_id(get_txn_id());
+        txn_requests_[i]->set_log_data_size(log_data_size);
+        txn_requests_[i]->set_txn_state(state);
+        txn_requests_[i]->set_semaphore(reinterpret_cast<uint64_t>
         (rpc_log_semaphore));
-        txn_requests_[i].set_coord_id(coord_id);
-        txn_requests_[i].set_forward_msg(forward_resp);
-        txn_requests_[i].set_node_id(g_node_id);
+        txn_requests_[i]->set_coord_id(coord_id);
+        txn_requests_[i]->set_forward_msg(forward_resp);
+        txn_requests_[i]->set_node_id(g_node_id);
         if (forward_resp == SundialRequest::RESP_OK)
-            txn_requests_[i].set_thd_id(_worker_thread->get_thd_id());
+            txn_requests_[i]->set_thd_id(_worker_thread->get_thd_id());
         else
-            txn_requests_[i].set_thd_id(thd_id);
+            txn_requests_[i]->set_thd_id(thd_id);
         // used for processing log delay
-        txn_requests_[i].set_receiver_id(i);
+        txn_requests_[i]->set_receiver_id(i);
         rpc_client->sendRequestAsync(this,
                                    i,
-                                   txn_requests_[i],
-                                   txn_responses_[i],
+                                   *txn_requests_[i],
+                                   *txn_responses_[i],
                                    true);
         sent++;
     }
@@ -478,35 +657,3 @@ void TxnManager::sendRemoteLogRequest(State state, uint64_t log_data_size,
 
 }
 
-void
-TxnManager::sendReplicateRequest(State state, uint64_t log_data_size) {
-    // log to local redis
-    string data = "[LSN] placehold:" + string(log_data_size, 'd');
-    // log to peer
-    size_t sent = 0;
-    for (size_t i = 0; i < g_num_storage_nodes; i++) {
-        if (i == g_node_id)
-            continue;
-        // XXX(zhihan): only send to # quorum of nodes to avoid null ref error
-        if (sent == g_quorum)
-            break;
-        rpc_log_semaphore->incr();
-        txn_requests_[i].set_request_type
-                (SundialRequest::PAXOS_REPLICATE);
-        txn_requests_[i].set_txn_id(get_txn_id());
-        txn_requests_[i].set_log_data_size(log_data_size);
-        txn_requests_[i].set_txn_state(state);
-        txn_requests_[i].set_semaphore(reinterpret_cast<uint64_t>(rpc_log_semaphore));
-        rpc_client->sendRequestAsync(this,
-                                     i,
-                                     txn_requests_[i],
-                                     txn_responses_[i],
-                                     true);
-        sent++;
-    }
-    // use sync request to avoid semaphore updating
-    redis_client->log_sync_data(g_node_id, get_txn_id(), state, data);
-    // wait for quorum
-    rpc_log_semaphore->wait();
-}
-
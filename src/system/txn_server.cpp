@@ -25,10 +25,14 @@
 #include "tictoc_manager.h"
 #include "lock_manager.h"
 #include "f1_manager.h"
+#include "mvcc_manager.h"
+#include "maat_manager.h"
 #if CC_ALG == NO_WAIT || CC_ALG == WAIT_DIE
 #include "row_lock.h"
 #endif
 #include "redis_client.h"
+#include "local_log_client.h"
+#include "lazy_log.h"
 #include "azure_blob_client.h"
 
 
@@ -41,6 +45,9 @@ TxnManager::process_prepare_request(const SundialRequest* request,
     assert(_txn_state == RUNNING);
     RC rc = RCOK;
     uint32_t num_tuples = request->tuple_data_size();
+#if CC_ALG == IDEAL_MVCC
+    ((CC_MAN *)_cc_manager)->set_commit_ts(request->ts());
+#endif
 #if CC_ALG == OCC
     // if occ, validate if can commit or not
     rc = _cc_manager->validate();
@@ -55,7 +62,17 @@ TxnManager::process_prepare_request(const SundialRequest* request,
         uint64_t key = request->tuple_data(i).key();
         uint64_t table_id = request->tuple_data(i).table_id();
         char * data = get_cc_manager()->get_data(key, table_id);
-        memcpy(data, request->tuple_data(i).data().c_str(), request->tuple_data(i).size());
+        copy_tuple_payload(data, get_tuple_payload(request, i), request->tuple_data(i).size());
+    }
+#endif
+#if CC_ALG == IDEAL_MVCC || CC_ALG == MAAT
+    // IDEAL_MVCC: validate with the commit timestamp of the coordinator
+    // MAAT: compute the local timestamp range
+    rc = _cc_manager->validate();
+    if (rc == ABORT) {
+        _cc_manager->cleanup(rc);
+        response->set_response_type( SundialResponse::PREPARED_ABORT );
+        return rc;
     }
 #endif
     // set up all nodes involved (including sender, excluding self)
@@ -64,7 +81,7 @@ TxnManager::process_prepare_request(const SundialRequest* request,
         uint64_t node_id = request->nodes(i).nid();
         if (node_id == g_node_id)
             continue;
-        _remote_nodes_involved[node_id] = new RemoteNodeInfo;
+        _remote_nodes_involved[node_id] = new_remote_node_info();
         // prepare request ensure all the nodes attached are rw
         _remote_nodes_involved[node_id]->is_readonly = false;
     }
@@ -75,7 +92,14 @@ TxnManager::process_prepare_request(const SundialRequest* request,
 #endif
 
     // log vote if the entire txn is read-write
-    if (request->nodes_size() != 0 && COMMIT_ALG != COORDINATOR_LOG) {
+    bool log_vote = request->nodes_size() != 0 && COMMIT_ALG != COORDINATOR_LOG;
+#if COMMIT_ALG == TWO_PC && TWO_PC_PRESUME != PRESUME_NOTHING
+    // a read-only participant leaves the protocol after its vote, so either
+    // presumption covers it.
+    if (num_tuples == 0 && CC_ALG != MAAT)
+        log_vote = false;
+#endif
+    if (log_vote) {
         string data = "[LSN] placehold:" + string(num_tuples * g_log_sz * 8, 'd');
         rpc_log_semaphore->incr();
         thd_id = request->thd_id();
@@ -85,6 +109,12 @@ TxnManager::process_prepare_request(const SundialRequest* request,
             #else
             redis_client->log_async_data(g_node_id, get_txn_id(), PREPARED, data);
             #endif  // ONE_PC
+        #elif LOG_DEVICE == LOG_DVC_LOCAL_FILE
+            #if COMMIT_ALG == ONE_PC
+            local_log_client->log_if_ne_data(g_node_id, get_txn_id(), data);
+            #else
+            local_log_client->log_async_data(g_node_id, get_txn_id(), PREPARED, data);
+            #endif  // ONE_PC
         #elif LOG_DEVICE == LOG_DVC_AZURE_BLOB
             #if COMMIT_ALG == ONE_PC
             azure_blob_client->log_if_ne_data(g_node_id, get_txn_id(), data);
@@ -109,7 +139,11 @@ TxnManager::process_prepare_request(const SundialRequest* request,
 
     // log msg no matter it is readonly or not
     SundialResponse::ResponseType response_type = SundialResponse::PREPARED_OK;
-    if (num_tuples != 0) {
+#if CC_ALG == MAAT
+    ((CC_MAN *)_cc_manager)->build_prepare_resp(*response);
+#endif
+    // MAAT: read-only participants also wait for the commit timestamp
+    if (num_tuples != 0 || CC_ALG == MAAT) {
         // read-write
         _txn_state = PREPARED;
     } else {
@@ -135,7 +169,12 @@ TxnManager::process_read_request(const SundialRequest* request,
     RC rc = RCOK;
     uint32_t num_tuples = request->tuple_data_size();
     num_tuples = request->read_requests_size();
-    for (uint32_t i = 0; i < num_tuples; i++) {
+#if CC_ALG == IDEAL_MVCC
+    // read from the snapshot of the coordinator
+    ((CC_MAN *)_cc_manager)->set_ts(request->ts());
+#endif
+    // a request served again resumes after the tuples already in response.
+    for (uint32_t i = response->tuple_data_size(); i < num_tuples; i++) {
         uint64_t key = request->read_requests(i).key();
         uint64_t index_id = request->read_requests(i).index_id();
         access_t access_type = (access_t)request->read_requests(i).access_type();
@@ -146,7 +185,7 @@ TxnManager::process_read_request(const SundialRequest* request,
         row_t * row = *rows->begin();
         get_cc_manager()->remote_key += 1;
         rc = get_cc_manager()->get_row(row, access_type, key);
-        if (rc == ABORT) {
+        if (rc == ABORT || rc == WAIT) {
             break;
         }
         uint64_t table_id = row->get_table_id();
@@ -157,15 +196,30 @@ TxnManager::process_read_request(const SundialRequest* request,
         tuple->set_size( tuple_size );
         tuple->set_access_type( access_type );
         tuple->set_index_id( index_id );
-        tuple->set_data( get_cc_manager()->get_data(key, table_id), tuple_size );
+        set_tuple_payload( tuple, get_cc_manager()->get_data(key, table_id), tuple_size );
     }
 
-    if (rc == ABORT) {
+    if (rc == WAIT) {
+        // [IDEAL_MVCC] the read is blocked by a committing writer.
+        return rc;
+    } else if (rc == ABORT) {
 	    _cc_manager->cleanup(ABORT);
          _txn_state = ABORTED;
         response->set_response_type( SundialResponse::RESP_ABORT );
     } else {
         response->set_response_type(SundialResponse::RESP_OK);
+#if SKIP_READONLY_PREPARE
+        if (request->read_only_txn()) {
+            // no prepare will come; the sub-txn ends here. Each read raised
+            // the read ts of its row to the snapshot (Row_MVCC::read), so a
+            // writer that validates later commits above the snapshot or
+            // aborts; the snapshot stays consistent without a prepare.
+            assert(is_read_only());
+            _cc_manager->cleanup(COMMIT);
+            _txn_state = COMMITTED;
+            rc = COMMIT;
+        }
+#endif
     }
     return rc;
 }
@@ -174,10 +228,26 @@ RC
 TxnManager::process_decision_request(const SundialRequest* request,
                                  SundialResponse* response, RC rc) {
     State status = (rc == COMMIT)? COMMITTED : ABORTED;
+#if CC_ALG == MAAT
+    if (rc == COMMIT)
+        ((CC_MAN *)_cc_manager)->set_commit_ts(request->ts());
+#endif
+#if COMMIT_ALG == TWO_PC && TWO_PC_PRESUME != PRESUME_NOTHING
+    thd_id = request->thd_id();
+    // only the decision the presumption would get wrong is forced.
+    if ((TWO_PC_PRESUME == PRESUME_ABORT) == (rc == ABORT)) {
+        lazy_log->append(get_txn_id(), status);
+    } else {
+        log_status_async(status);
+        rpc_log_semaphore->wait();
+    }
+#else
     rpc_log_semaphore->incr();
     thd_id = request->thd_id();
     #if LOG_DEVICE == LOG_DVC_REDIS
     redis_client->log_async(g_node_id, get_txn_id(), status);
+    #elif LOG_DEVICE == LOG_DVC_LOCAL_FILE
+    local_log_client->log_async(g_node_id, get_txn_id(), status);
     #elif LOG_DEVICE == LOG_DVC_AZURE_BLOB
     azure_blob_client->log_async(g_node_id, get_txn_id(), status);
     #elif LOG_DEVICE == LOG_DVC_CUSTOMIZED
@@ -188,6 +258,7 @@ TxnManager::process_decision_request(const SundialRequest* request,
     #endif
 
     rpc_log_semaphore->wait();
+#endif
     _txn_state = (rc == COMMIT)? COMMITTED : ABORTED;
     _cc_manager->cleanup(rc);
     _finish_time = get_sys_clock();
@@ -213,6 +284,11 @@ TxnManager::process_terminate_request(const SundialRequest* request,
             == FAIL) {
                 return FAIL;
             }
+            #elif LOG_DEVICE == LOG_DVC_LOCAL_FILE
+            if (local_log_client->log_sync(g_node_id, get_txn_id(), ABORTED)
+            == FAIL) {
+                return FAIL;
+            }
             #elif LOG_DEVICE == LOG_DVC_AZURE_BLOB
             if (azure_blob_client->log_sync(g_node_id, get_txn_id(), ABORTED)
             == FAIL) {
@@ -19,13 +19,14 @@ TxnTable::TxnTable()
 }
 
 void
-TxnTable::add_txn(TxnManager * txn)
+TxnTable::add_txn(TxnManager * txn, bool pin)
 {
     assert(get_txn(txn->get_txn_id()) == NULL);
 
     uint32_t bucket_id = txn->get_txn_id() % _txn_table_size;
     Node * node = new Node; // *) _mm_malloc(sizeof(Node), 64);
     node->txn = txn;
+    node->ref = pin? 1 : 0;
       while ( !ATOM_CAS(_buckets[bucket_id]->latch, false, true) )
         PAUSE
     COMPILER_BARRIER
@@ -49,20 +50,102 @@ TxnTable::get_txn(uint64_t txn_id, bool remove, bool validate)
         node = node->next;
     }
     TxnManager * txn = nullptr;
+    bool claimed = false;
     if (node) {
         if (node->valid || !validate) {
-            if (validate && remove)
+            if (validate && remove) {
                 node->valid = false;
-            // increment reference count for safety
-            // no need to be atomic since protected by latch.
+                claimed = true;
+            }
             txn = node->txn;
         }
     }
     COMPILER_BARRIER
     _buckets[bucket_id]->latch = false;
+    // the node is not removed by anyone else once claimed.
+    if (claimed)
+        while (node->ref > 0)
+            PAUSE
+    COMPILER_BARRIER
     return txn;
 }
 
+void
+TxnTable::unclaim_txn(TxnManager * txn)
+{
+    Node * node = lock_node(txn->get_txn_id());
+    assert(node && node->txn == txn && !node->valid);
+    node->valid = true;
+    unlock_node(txn->get_txn_id());
+}
+
+TxnManager *
+TxnTable::pin_txn(uint64_t txn_id, bool * claimed)
+{
+    Node * node = lock_node(txn_id);
+    TxnManager * txn = nullptr;
+    if (node && node->valid) {
+        node->ref ++;
+        txn = node->txn;
+    }
+    if (claimed)
+        *claimed = (node && !node->valid);
+    unlock_node(txn_id);
+    return txn;
+}
+
+bool
+TxnTable::unpin_txn(TxnManager * txn, bool remove)
+{
+    Node * node = lock_node(txn->get_txn_id());
+    assert(node && node->txn == txn && node->ref > 0);
+    // a claimer may wait for ref to drop; it then removes the txn itself.
+    remove = remove && node->valid;
+    if (remove)
+        node->valid = false;
+    node->ref --;
+    unlock_node(txn->get_txn_id());
+    if (remove)
+        remove_txn(txn);
+    return remove;
+}
+
+TxnTable::Node *
+TxnTable::lock_node(uint64_t txn_id)
+{
+    uint32_t bucket_id = txn_id % _txn_table_size;
+    while ( !ATOM_CAS(_buckets[bucket_id]->latch, false, true) )
+        PAUSE
+    COMPILER_BARRIER
+    Node * node = _buckets[bucket_id]->first;
+    while (node && node->txn->get_txn_id() != txn_id)
+        node = node->next;
+    return node;
+}
+
+void
+TxnTable::unlock_node(uint64_t txn_id)
+{
+    COMPILER_BARRIER
+    _buckets[txn_id % _txn_table_size]->latch = false;
+}
+
+void
+TxnTable::find_txns(const std::function<bool(TxnManager *)> & filter,
+                    vector<uint64_t> & txn_ids)
+{
+    for (uint32_t i = 0; i < _txn_table_size; i++) {
+        while ( !ATOM_CAS(_buckets[i]->latch, false, true) )
+            PAUSE
+        COMPILER_BARRIER
+        for (Node * node = _buckets[i]->first; node; node = node->next)
+            if (node->valid && filter(node->txn))
+                txn_ids.push_back(node->txn->get_txn_id());
+        COMPILER_BARRIER
+        _buckets[i]->latch = false;
+    }
+}
+
 void
 TxnTable::print_txn()
 {
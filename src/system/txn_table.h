@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include "global.h"
 
 // For Distributed DBMS
@@ -12,7 +13,9 @@ class TxnTable
 public:
     struct Node {
         TxnManager * txn;
+        // false once the txn is claimed
         volatile bool valid;
+        // number of request handlers that pinned the txn
         volatile uint64_t ref;
         Node * next;
         Node() : txn(nullptr), valid(true), ref(0), next(nullptr) {};
@@ -20,12 +23,29 @@ public:
 
     TxnTable();
     // should support 3 methods: add_txn, get_txn, remove_txn
-    void add_txn(TxnManager * txn);
+    // with pin, the txn is added pinned (see pin_txn).
+    void add_txn(TxnManager * txn, bool pin=false);
     void remove_txn(TxnManager * txn);
     void print_txn();
 
+    // with validate, a claimed txn is not returned; with remove as well, the
+    // txn is claimed: the caller is then the only one to end and remove it.
+    // A claim waits for the handlers that pinned the txn to unpin it.
     TxnManager * get_txn(uint64_t txn_id, bool remove=false, bool
     validate=false);
+    // undo a claim; the txn can be pinned and claimed again.
+    void unclaim_txn(TxnManager * txn);
+    // pin the txn while a request handler uses it, so that it is not claimed
+    // meanwhile. Returns nullptr if the txn is not in the table or already
+    // claimed; *claimed tells which.
+    TxnManager * pin_txn(uint64_t txn_id, bool * claimed=nullptr);
+    // with remove, the txn is also removed unless it was claimed meanwhile.
+    // Returns true if it was removed; the caller then deletes it.
+    bool unpin_txn(TxnManager * txn, bool remove);
+    // ids of the txns for which filter() holds. filter() runs with the bucket
+    // latched, so the txn cannot be removed meanwhile.
+    void find_txns(const std::function<bool(TxnManager *)> & filter,
+                   vector<uint64_t> & txn_ids);
     uint32_t get_size();
 
 private:
@@ -34,6 +54,10 @@ private:
         volatile bool latch;
     };
 
+    // latch the bucket of txn_id and return its node, if any.
+    Node * lock_node(uint64_t txn_id);
+    void unlock_node(uint64_t txn_id);
+
     Bucket ** _buckets;
     uint32_t _txn_table_size;
 };
@@ -11,6 +11,8 @@
 #include "tpcc_query.h"
 #include "txn_table.h"
 #include "cc_manager.h"
+#include "hot_key_tracker.h"
+#include "det_scheduler.h"
 
 WorkerThread::WorkerThread(uint64_t thd_id)
     : BaseThread(thd_id, WORKER_THREAD)
@@ -47,6 +49,11 @@ RC WorkerThread::run() {
 
     // Main loop
     while ( (get_sys_clock() - _init_time) < (g_run_time * BILLION)) {
+#if FAILURE_ENABLE
+        if (g_node_id == FAILURE_NODE && get_sys_clock() - _init_time > g_failure_pt
+            && ATOM_CAS(glob_manager->active, true, false))
+            glob_manager->inject_failure();
+#endif
         if (!glob_manager->active) {
             glob_manager->worker_thread_done();
             return FAIL;
@@ -55,12 +62,41 @@ RC WorkerThread::run() {
 //            glob_stats->checkpoint();
 //            last_stats_cp_time += STATS_CP_INTERVAL * 1000000;
 //        }
+#if HOT_KEY_TRACKING
+        if (get_thd_id() == 0)
+            hot_key_tracker->try_merge();
+#endif
+#if DETERMINISTIC
+        // the scheduler orders conflicting txns, so a txn never restarts.
+        uint32_t slot;
+        QueryBase * det_query = det_scheduler->get_query(slot);
+        if (!det_query)
+            continue;
+        uint64_t det_txn_id = max_txn_id ++;
+        det_txn_id = det_txn_id * g_num_worker_threads + _thd_id;
+        det_txn_id = det_txn_id * g_num_nodes + g_node_id;
+        _native_txn = new TxnManager(det_query, this);
+        _native_txn->set_txn_id( det_txn_id );
+        txn_table->add_txn( _native_txn );
+        _native_txn->start();
+        assert(_native_txn->get_txn_state() == TxnManager::COMMITTED
+               || (_native_txn->get_store_procedure()->is_self_abort()
+                   && _native_txn->get_txn_state() == TxnManager::ABORTED));
+        txn_table->remove_txn(_native_txn);
+        delete _native_txn;
+        _native_txn = nullptr;
+        det_scheduler->finish_query(slot);
+        continue;
+#endif
         if (_native_txn) {
 #if DEBUG_PRINT
             printf("[node-%u, txn-%lu] restart for %lu times.\n",
                  g_node_id, _native_txn->get_txn_id(), _native_txn->num_aborted);
 #endif
             // restart a previously aborted transaction
+#if HOT_KEY_BATCHING
+            hot_key_tracker->enter_batch(_native_txn->get_store_procedure()->get_query());
+#endif
             _native_txn->restart();
         } else {
             // start a new transaction
@@ -78,8 +114,14 @@ RC WorkerThread::run() {
                    g_node_id, _native_txn->get_txn_id());
 #endif
             txn_table->add_txn( _native_txn );
+#if HOT_KEY_BATCHING
+            hot_key_tracker->enter_batch(query);
+#endif
             _native_txn->start();
         }
+#if HOT_KEY_BATCHING
+        hot_key_tracker->exit_batch();
+#endif
 #if DEBUG_PRINT
         printf("[node-%u, txn-%lu] finish native txn (state=%d).\n",
                g_node_id, _native_txn->get_txn_id(),
@@ -88,8 +130,12 @@ RC WorkerThread::run() {
         if (_native_txn->get_txn_state() == TxnManager::COMMITTED
             || (_native_txn->get_store_procedure()->is_self_abort()
                 && _native_txn->get_txn_state() == TxnManager::ABORTED)) {
-            txn_table->remove_txn(_native_txn);
-            delete _native_txn;
+            if (_native_txn->is_async_commit())
+                _native_txn->release_async_commit();
+            else {
+                txn_table->remove_txn(_native_txn);
+                delete _native_txn;
+            }
             _native_txn = nullptr;
         } else { // should restart
             _native_txn->num_aborted++;
@@ -4,10 +4,15 @@
 #include "global.h"
 #if LOG_DEVICE == LOG_DVC_AZURE_BLOB
 
+#include <atomic>
+#include <cstring>
+#include <memory>
 #include <sstream>
+#include <thread>
 #include <unistd.h>
 
 #include "azure_blob_client.h"
+#include "semaphore_sync.h"
 #include "txn.h"
 #include "txn_table.h"
 #include "manager.h"
@@ -21,8 +26,11 @@ void ab_sync_callback(cpp_redis::reply & response);
 */
 
 AzureBlobClient::AzureBlobClient() {
-    const utility::string_t storage_connection_string(
+    utility::string_t storage_connection_string(
             U("DefaultEndpointsProtocol=https;AccountName=cornuslog;AccountKey=eyXp2hguWSy9TvS8AGTp9n7O2GjqJIp/5bvT83BO7OWajfLhVmPNUL1qBWYfgj6dBs++aZ0Y0lja6K7vDIj83Q==;EndpointSuffix=core.windows.net"));
+    // e.g., "UseDevelopmentStorage=true" for a local Azurite
+    if (getenv("AZURE_STORAGE_CONNECTION_STRING"))
+        storage_connection_string = U(getenv("AZURE_STORAGE_CONNECTION_STRING"));
 
     try {
         // Retrieve storage account from connection string.
@@ -46,10 +54,386 @@ AzureBlobClient::AzureBlobClient() {
         std::wcout << U("Expected Race Condition [node-") << g_node_id << U("] :")
         << e.what() << std::endl;
     }
+#if AZURE_BATCHED_LOG
+    pthread_mutex_init(&_latch, NULL);
+    pthread_cond_init(&_cond, NULL);
+    _next_seq = 0;
+    _next_node = 0;
+    _logs = new NodeLog [g_num_nodes];
+    for (uint32_t i = 0; i < g_num_nodes; i++) {
+        NodeLog &log = _logs[i];
+        log.node_id = i;
+        pthread_mutex_init(&log.scan_latch, NULL);
+        log.blob = get_blob(i, 0);
+        log.blob_id = 0;
+        log.scan_blob_id = 0;
+        log.scanned = 0;
+        log.evicted_txn_id = 0;
+    }
+    for (uint32_t i = 0; i < AZURE_LOG_POOL_SIZE; i++)
+        new std::thread(FlushBatches, this);
+#endif
 
     std::cout << "[Sundial] connected to azure blob storage!" << std::endl;
 }
 
+#if AZURE_BATCHED_LOG
+
+void
+AzureBlobClient::append(uint64_t node_id, uint64_t txn_id, int status, bool cond,
+                        const string * data, std::function<void(int)> done)
+{
+    // record: header line "writer seq txn_id cond status data_size", data, "\n"
+    char header[128];
+    uint64_t data_size = data? data->size() : 0;
+    pthread_mutex_lock(&_latch);
+    uint64_t seq = _next_seq ++;
+    int len = snprintf(header, sizeof(header), "%u %lu %lu %d %d %lu\n", g_node_id,
+                       seq, txn_id, cond? 1 : 0, status, data_size);
+    NodeLog &log = _logs[node_id];
+    // wait for a request of the pool to take the batch if it is full.
+    while (!log.batch.empty()
+           && log.batch.size() + len + data_size + 1 > AZURE_MAX_APPEND_SIZE)
+        pthread_cond_wait(&_cond, &_latch);
+    log.batch.append(header, len);
+    if (data)
+        log.batch.append(*data);
+    log.batch.push_back('\n');
+    log.callbacks.push_back(std::make_pair(seq, done));
+    pthread_cond_broadcast(&_cond);
+    pthread_mutex_unlock(&_latch);
+}
+
+void
+AzureBlobClient::FlushBatches(AzureBlobClient * client)
+{
+    string batch;
+    vector<std::pair<uint64_t, std::function<void(int)> > > callbacks;
+    pthread_mutex_lock(&client->_latch);
+    while (true) {
+        // take the next non-empty batch, round robin over the nodes
+        NodeLog * log = NULL;
+        for (uint32_t i = 0; i < g_num_nodes && !log; i++) {
+            uint32_t node = (client->_next_node + i) % g_num_nodes;
+            if (!client->_logs[node].batch.empty()) {
+                log = &client->_logs[node];
+                client->_next_node = node + 1;
+            }
+        }
+        if (!log) {
+            pthread_cond_wait(&client->_cond, &client->_latch);
+            continue;
+        }
+        // records arriving meanwhile form the next batch.
+        batch.swap(log->batch);
+        callbacks.swap(log->callbacks);
+        pthread_cond_broadcast(&client->_cond);
+        pthread_mutex_unlock(&client->_latch);
+        client->flush(log, batch, callbacks);
+        batch.clear();
+        callbacks.clear();
+        pthread_mutex_lock(&client->_latch);
+    }
+}
+
+void
+AzureBlobClient::flush(NodeLog * log, string & batch,
+                       vector<std::pair<uint64_t, std::function<void(int)> > > & callbacks)
+{
+    int64_t offset = -1;
+    uint32_t blob_id;
+    while (offset < 0) {
+        pthread_mutex_lock(&log->scan_latch);
+        azure::storage::cloud_append_blob blob = log->blob;
+        blob_id = log->blob_id;
+        pthread_mutex_unlock(&log->scan_latch);
+        try {
+            // appends are atomic; the returned offset orders them in the blob.
+            offset = blob.append_block(
+                concurrency::streams::bytestream::open_istream(batch), utility::string_t());
+        } catch (const azure::storage::storage_exception &e) {
+            if (e.result().extended_error().code() == U("BlockCountExceedsLimit")) {
+                roll_over(log, blob_id);
+                continue;
+            }
+            std::cout << "[Sundial] failed to append to the azure log: " << e.what()
+                      << std::endl;
+            M_ASSERT(false, "failed to append to the azure log\n");
+        }
+    }
+    INC_INT_STATS(num_log_group_commits, 1);
+    INC_INT_STATS(num_log_group_records, callbacks.size());
+    vector<int> results;
+    pthread_mutex_lock(&log->scan_latch);
+    scan(log, blob_id, offset, batch);
+    for (auto &callback : callbacks) {
+        auto it = log->results.find(callback.first);
+        assert(it != log->results.end());
+        results.push_back(it->second);
+        log->results.erase(it);
+    }
+    pthread_mutex_unlock(&log->scan_latch);
+    for (size_t i = 0; i < callbacks.size(); i++)
+        callbacks[i].second(results[i]);
+}
+
+void
+AzureBlobClient::roll_over(NodeLog * log, uint32_t blob_id)
+{
+    pthread_mutex_lock(&log->scan_latch);
+    // another flush may have moved on already.
+    if (log->blob_id == blob_id) {
+        log->blob = get_blob(log->node_id, blob_id + 1);
+        log->blob_id = blob_id + 1;
+        INC_INT_STATS(num_log_blob_rollovers, 1);
+    }
+    pthread_mutex_unlock(&log->scan_latch);
+}
+
+azure::storage::cloud_append_blob
+AzureBlobClient::get_blob(uint32_t node_id, uint32_t blob_id)
+{
+    azure::storage::cloud_append_blob blob = container.get_append_blob_reference(
+        U("log-" + std::to_string(node_id) + "-" + std::to_string(blob_id)));
+    try {
+        blob.create_or_replace(
+            azure::storage::access_condition::generate_if_not_exists_condition(),
+            azure::storage::blob_request_options(),
+            azure::storage::operation_context());
+    } catch (const azure::storage::storage_exception &e) {
+        // created by another node
+    }
+    return blob;
+}
+
+void
+AzureBlobClient::read(uint32_t node_id, uint32_t blob_id, int64_t offset,
+                      int64_t end, std::vector<uint8_t> & bytes)
+{
+    azure::storage::cloud_append_blob blob = container.get_append_blob_reference(
+        U("log-" + std::to_string(node_id) + "-" + std::to_string(blob_id)));
+    if (end < 0) {
+        blob.download_attributes();
+        end = blob.properties().size();
+    }
+    bytes.clear();
+    if (end <= offset)
+        return;
+    concurrency::streams::container_buffer<std::vector<uint8_t> > buffer;
+    blob.download_range_to_stream(buffer.create_ostream(), offset, end - offset);
+    bytes = buffer.collection();
+}
+
+void
+AzureBlobClient::scan(NodeLog * log, uint32_t blob_id, int64_t offset,
+                      const string & batch)
+{
+    int64_t end = offset + batch.size();
+    if (log->scan_blob_id > blob_id
+        || (log->scan_blob_id == blob_id && log->scanned >= end))
+        return;
+    std::vector<uint8_t> bytes;
+    // the blobs before blob_id are full and will not grow any more.
+    while (log->scan_blob_id < blob_id) {
+        read(log->node_id, log->scan_blob_id, log->scanned, -1, bytes);
+        parse(log, log->scan_blob_id, log->scanned, (const char *) bytes.data(),
+              bytes.size());
+        log->scan_blob_id ++;
+        log->scanned = 0;
+    }
+    if (log->scanned == offset) {
+        // nothing was appended before this batch since the last scan
+        parse(log, blob_id, offset, batch.data(), batch.size());
+    } else {
+        read(log->node_id, blob_id, log->scanned, end, bytes);
+        parse(log, blob_id, log->scanned, (const char *) bytes.data(), bytes.size());
+    }
+    log->scanned = end;
+    while (log->status.size() > AZURE_LOG_STATUS_CACHE_SIZE) {
+        log->evicted_txn_id = std::max(log->evicted_txn_id,
+                                       log->status.begin()->first + 1);
+        log->status.erase(log->status.begin());
+    }
+}
+
+size_t
+AzureBlobClient::parse_record(const char * bytes, size_t size, size_t pos,
+                              Record & record)
+{
+    // record: header line "writer seq txn_id cond status data_size", data, "\n"
+    const char * line_end = (const char *) memchr(bytes + pos, '\n', size - pos);
+    assert(line_end);
+    int num = sscanf(bytes + pos, "%u %lu %lu %d %d %lu", &record.writer,
+                     &record.seq, &record.txn_id, &record.cond, &record.status,
+                     &record.data_size);
+    M_ASSERT(num == 6, "corrupted azure log record\n");
+    return line_end - bytes + 1 + record.data_size + 1;
+}
+
+void
+AzureBlobClient::parse(NodeLog * log, uint32_t blob_id, int64_t offset,
+                       const char * bytes, size_t size)
+{
+    size_t pos = 0;
+    Record record;
+    while (pos < size) {
+        size_t next = parse_record(bytes, size, pos, record);
+        auto it = log->status.find(record.txn_id);
+        if (it == log->status.end()) {
+            int status = -1;
+            if (record.txn_id < log->evicted_txn_id)
+                status = lookup(log, record.txn_id, blob_id, offset + pos);
+            if (status == -1 || !record.cond)
+                status = record.status;
+            it = log->status.insert(std::make_pair(record.txn_id, status)).first;
+        } else if (!record.cond)
+            it->second = record.status;
+        if (record.writer == g_node_id)
+            log->results[record.seq] = it->second;
+        pos = next;
+    }
+}
+
+int
+AzureBlobClient::lookup(NodeLog * log, uint64_t txn_id, uint32_t blob_id,
+                        int64_t offset)
+{
+    INC_INT_STATS(num_log_status_lookups, 1);
+    int status = -1;
+    std::vector<uint8_t> bytes;
+    for (uint32_t i = 0; i <= blob_id; i++) {
+        read(log->node_id, i, 0, (i == blob_id)? offset : -1, bytes);
+        size_t pos = 0;
+        Record record;
+        while (pos < bytes.size()) {
+            pos = parse_record((const char *) bytes.data(), bytes.size(), pos, record);
+            if (record.txn_id == txn_id && (!record.cond || status == -1))
+                status = record.status;
+        }
+    }
+    return status;
+}
+
+RC
+AzureBlobClient::log_sync(uint64_t node_id, uint64_t txn_id, int status) {
+    if (!glob_manager->active)
+        return FAIL;
+    uint64_t starttime = get_sys_clock();
+    SemaphoreSync sem;
+    sem.incr();
+    append(node_id, txn_id, status, false, NULL, [&sem](int) { sem.decr(); });
+    sem.wait();
+    INC_FLOAT_STATS(log_sync, get_sys_clock() - starttime);
+    INC_INT_STATS(num_log_sync, 1);
+    return RCOK;
+}
+
+RC
+AzureBlobClient::log_async(uint64_t node_id, uint64_t txn_id, int status) {
+    if (!glob_manager->active)
+        return FAIL;
+    uint64_t starttime = get_sys_clock();
+    append(node_id, txn_id, status, false, NULL, [txn_id, starttime](int) {
+        TxnManager *txn = txn_table->get_txn(txn_id, false, false);
+        if (txn != NULL) {
+            txn->rpc_log_semaphore->decr();
+        }
+        INC_FLOAT_STATS(log_async, get_sys_clock() - starttime);
+        INC_INT_STATS(num_log_async, 1);
+    });
+    return RCOK;
+}
+
+// used for termination protocol, req is always LOG_ABORT
+RC
+AzureBlobClient::log_if_ne(uint64_t node_id, uint64_t txn_id) {
+    if (!glob_manager->active)
+        return FAIL;
+    uint64_t starttime = get_sys_clock();
+    append(node_id, txn_id, TxnManager::ABORTED, true, NULL,
+           [txn_id, starttime](int status) {
+        TxnManager::State state = (TxnManager::State) status;
+        TxnManager *txn = txn_table->get_txn(txn_id, false, false);
+        if (txn != NULL) {
+            // default is commit, only need to set abort or committed
+            if (state == TxnManager::ABORTED) {
+                txn->set_decision(ABORT);
+            } else if (state == TxnManager::COMMITTED) {
+                txn->set_decision(COMMIT);
+            } else if (state != TxnManager::PREPARED) {
+                std::cout << "[WARNING] [log-if-ne] unknown state: " << state << std::endl;
+                assert(false);
+            }
+            // mark as returned.
+            txn->rpc_log_semaphore->decr();
+        }
+        INC_FLOAT_STATS(log_if_ne, get_sys_clock() - starttime);
+        INC_INT_STATS(num_log_if_ne, 1);
+    });
+    return RCOK;
+}
+
+// used for prepare, req is always LOG_YES_REQ
+RC
+AzureBlobClient::log_if_ne_data(uint64_t node_id, uint64_t txn_id, string &data) {
+    if (!glob_manager->active)
+        return FAIL;
+    uint64_t starttime = get_sys_clock();
+    append(node_id, txn_id, TxnManager::PREPARED, true, &data,
+           [txn_id, starttime](int status) {
+        TxnManager::State state = (TxnManager::State) status;
+        TxnManager *txn = txn_table->get_txn(txn_id, false, false);
+        if (txn != NULL) {
+            // status can only be aborted/prepared
+            if (state == TxnManager::ABORTED) {
+                txn->set_txn_state(TxnManager::ABORTED);
+            } else if (state != TxnManager::PREPARED) {
+                std::cout << "[WARNING] [log-if-ne-data] unknown state: " << state << std::endl;
+            }
+            // mark as returned.
+            txn->rpc_log_semaphore->decr();
+        }
+        INC_FLOAT_STATS(log_if_ne_data, get_sys_clock() - starttime);
+        INC_INT_STATS(num_log_if_ne_data, 1);
+    });
+    return RCOK;
+}
+
+// synchronous
+RC
+AzureBlobClient::log_sync_data(uint64_t node_id, uint64_t txn_id, int status,
+                               string &data) {
+    if (!glob_manager->active)
+        return FAIL;
+    uint64_t starttime = get_sys_clock();
+    SemaphoreSync sem;
+    sem.incr();
+    append(node_id, txn_id, status, false, &data, [&sem](int) { sem.decr(); });
+    sem.wait();
+    INC_FLOAT_STATS(log_sync_data, get_sys_clock() - starttime);
+    INC_INT_STATS(num_log_sync_data, 1);
+    return RCOK;
+}
+
+RC
+AzureBlobClient::log_async_data(uint64_t node_id, uint64_t txn_id, int status,
+                                string &data) {
+    if (!glob_manager->active)
+        return FAIL;
+    uint64_t starttime = get_sys_clock();
+    append(node_id, txn_id, status, false, &data, [txn_id, starttime](int) {
+        INC_FLOAT_STATS(log_async_data, get_sys_clock() - starttime);
+        INC_INT_STATS(num_log_async_data, 1);
+        TxnManager *txn = txn_table->get_txn(txn_id, false, false);
+        if (txn != NULL) {
+            txn->rpc_log_semaphore->decr();
+        }
+    });
+    return RCOK;
+}
+
+#else
+
 RC
 AzureBlobClient::log_sync(uint64_t node_id, uint64_t txn_id, int status) {
     if (!glob_manager->active)
@@ -336,4 +720,84 @@ AzureBlobClient::log_async_data(uint64_t node_id, uint64_t txn_id, int status,
     return RCOK;
 }
 
+#endif  // AZURE_BATCHED_LOG
+
+RC
+AzureBlobClient::log_async_batch(uint64_t node_id, const std::vector<uint64_t> & txn_ids,
+                                 const std::vector<int> & statuses,
+                                 const std::function<void()> & callback) {
+    if (!glob_manager->active)
+        return FAIL;
+    assert(txn_ids.size() == statuses.size());
+    if (txn_ids.empty())
+        return RCOK;
+    uint64_t starttime = get_sys_clock();
+    // the records may be written by different requests
+    std::shared_ptr<std::atomic<uint64_t> > remaining(
+        new std::atomic<uint64_t>(txn_ids.size()));
+    auto done = [remaining, callback, starttime]() {
+        if (-- (*remaining) == 0) {
+            INC_FLOAT_STATS(log_async, get_sys_clock() - starttime);
+            INC_INT_STATS(num_log_async, 1);
+            callback();
+        }
+    };
+    for (size_t i = 0; i < txn_ids.size(); i++) {
+#if AZURE_BATCHED_LOG
+        append(node_id, txn_ids[i], statuses[i], false, NULL, [done](int) { done(); });
+#else
+        string id = std::to_string(node_id) + "-" + std::to_string(txn_ids[i]);
+        azure::storage::cloud_block_blob blob = container.get_block_blob_reference(U("status-" + id));
+        blob.upload_text_async(U(std::to_string(statuses[i]))).then(done);
+#endif
+    }
+    return RCOK;
+}
+
+RC
+AzureBlobClient::log_if_ne_batch(uint64_t node_id, const std::vector<uint64_t> & txn_ids,
+                                 const std::function<void(const std::vector<int> &)> & callback) {
+    if (!glob_manager->active)
+        return FAIL;
+    if (txn_ids.empty())
+        return RCOK;
+    uint64_t starttime = get_sys_clock();
+    // the records may be resolved by different requests
+    std::shared_ptr<std::vector<int> > statuses(new std::vector<int>(txn_ids.size()));
+    std::shared_ptr<std::atomic<uint64_t> > remaining(
+        new std::atomic<uint64_t>(txn_ids.size()));
+    auto done = [statuses, remaining, callback, starttime](size_t i, int status) {
+        (*statuses)[i] = status;
+        if (-- (*remaining) == 0) {
+            INC_FLOAT_STATS(log_if_ne_batch, get_sys_clock() - starttime);
+            INC_INT_STATS(num_log_if_ne_batch, 1);
+            callback(*statuses);
+        }
+    };
+    for (size_t i = 0; i < txn_ids.size(); i++) {
+#if AZURE_BATCHED_LOG
+        append(node_id, txn_ids[i], TxnManager::ABORTED, true, NULL,
+               [done, i](int status) { done(i, status); });
+#else
+        string id = std::to_string(node_id) + "-" + std::to_string(txn_ids[i]);
+        azure::storage::cloud_block_blob blob = container.get_block_blob_reference(U("status-" + id));
+        blob.upload_text_async(U(std::to_string(TxnManager::ABORTED)),
+            azure::storage::access_condition::generate_if_not_exists_condition(),
+            azure::storage::blob_request_options(), azure::storage::operation_context())
+            .then([blob, done, i](pplx::task<void> previous_task) {
+            int status = TxnManager::ABORTED;
+            try {
+                previous_task.get(); // to throw exception if exists
+            } catch (azure::storage::storage_exception & e) {
+                // the status may be followed by data
+                utility::string_t text = blob.download_text();
+                status = std::stoi(text.substr(0, text.find(",")));
+            }
+            done(i, status);
+        });
+#endif
+    }
+    return RCOK;
+}
+
 #endif
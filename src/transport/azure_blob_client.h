@@ -15,7 +15,10 @@
 #include <was/blob.h>
 #include <cpprest/filestream.h>
 #include <cpprest/containerstream.h>
+#include <functional>
+#include <map>
 #include <string>
+#include <vector>
 
 #include "helper.h"
 
@@ -25,15 +28,96 @@ class AzureBlobClient {
     RC log_sync(uint64_t node_id, uint64_t txn_id, int status);
     RC log_async(uint64_t node_id, uint64_t txn_id, int status);
     RC log_if_ne(uint64_t node_id, uint64_t txn_id);
+    // log_if_ne for many txns of node_id at once. callback gets the
+    // resulting status of each txn, in order.
+    RC log_if_ne_batch(uint64_t node_id, const std::vector<uint64_t> & txn_ids,
+        const std::function<void(const std::vector<int> &)> & callback);
     RC log_if_ne_data(uint64_t node_id, uint64_t txn_id, std::string & data);
     RC log_sync_data(uint64_t node_id, uint64_t txn_id, int status,
         std::string & data);
     RC log_async_data(uint64_t node_id, uint64_t txn_id, int status,
         std::string & data);
+    // set the status of many txns of node_id at once. callback runs once
+    // all of them are written.
+    RC log_async_batch(uint64_t node_id, const std::vector<uint64_t> & txn_ids,
+        const std::vector<int> & statuses, const std::function<void()> & callback);
   private:
     azure::storage::cloud_storage_account storage_account;
     azure::storage::cloud_blob_client blob_client;
     azure::storage::cloud_blob_container container;
+#if AZURE_BATCHED_LOG
+    // All records about the txns of node n (its own votes and decisions, and
+    // the aborts other nodes log for it during termination) are appended to
+    // the append blobs "log-<n>-<k>". An append blob holds at most 50,000
+    // blocks; once blob k is full, no append to it succeeds any more and
+    // writers move on to blob k+1, so the blobs read in order are the log.
+    // The conditional writes are resolved by parsing the log in append order;
+    // each client caches the statuses up to the offset it parsed, so
+    // resolving a batch takes at most one range read per blob.
+    struct NodeLog {
+        uint32_t                            node_id;
+        // records not yet sent and their callbacks, by sequence number
+        std::string                         batch;
+        std::vector<std::pair<uint64_t, std::function<void(int)> > > callbacks;
+        // protects the fields below
+        pthread_mutex_t                     scan_latch;
+        // the blob appended to
+        azure::storage::cloud_append_blob   blob;
+        uint32_t                            blob_id;
+        // the log is parsed up to offset scanned of blob scan_blob_id
+        uint32_t                            scan_blob_id;
+        int64_t                             scanned;
+        // latest status of each txn, for at most AZURE_LOG_STATUS_CACHE_SIZE
+        // txns; the lowest txn ids are evicted first.
+        std::map<uint64_t, int>             status;
+        // txns below this id may have been evicted from status
+        uint64_t                            evicted_txn_id;
+        // status right after each record of this client, by sequence number
+        std::map<uint64_t, int>             results;
+    };
+    struct Record {
+        uint32_t    writer;
+        uint64_t    seq;
+        uint64_t    txn_id;
+        int         cond;
+        int         status;
+        uint64_t    data_size;
+    };
+    // add a record to the batch of node_id; cond means set only if the txn
+    // has no status. done(status) runs once the record is appended, with the
+    // status of the txn right after it.
+    void append(uint64_t node_id, uint64_t txn_id, int status, bool cond,
+                const std::string * data, std::function<void(int)> done);
+    void flush(NodeLog * log, std::string & batch,
+               std::vector<std::pair<uint64_t, std::function<void(int)> > > & callbacks);
+    // the blob after blob_id, once blob_id is full.
+    void roll_over(NodeLog * log, uint32_t blob_id);
+    azure::storage::cloud_append_blob get_blob(uint32_t node_id, uint32_t blob_id);
+    // read [offset, end) of a blob; end < 0 reads to the end of the blob.
+    void read(uint32_t node_id, uint32_t blob_id, int64_t offset, int64_t end,
+              std::vector<uint8_t> & bytes);
+    // parse the log up to the end of batch, appended at offset of blob_id.
+    // Called with log->scan_latch held.
+    void scan(NodeLog * log, uint32_t blob_id, int64_t offset,
+              const std::string & batch);
+    // bytes start at offset of blob_id.
+    void parse(NodeLog * log, uint32_t blob_id, int64_t offset,
+               const char * bytes, size_t size);
+    // parse the record at pos; returns the position of the next one.
+    static size_t parse_record(const char * bytes, size_t size, size_t pos,
+                               Record & record);
+    // status of an evicted txn, from the log before offset of blob_id, or
+    // -1 if it has none.
+    int lookup(NodeLog * log, uint64_t txn_id, uint32_t blob_id, int64_t offset);
+    // one thread per request of the pool, each sending a batch at a time.
+    static void FlushBatches(AzureBlobClient * client);
+
+    pthread_mutex_t     _latch;
+    pthread_cond_t      _cond;
+    NodeLog *           _logs;
+    uint64_t            _next_seq;
+    uint32_t            _next_node;
+#endif
 };
 
 #endif
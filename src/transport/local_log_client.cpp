@@ -0,0 +1,515 @@
+#include "global.h"
+#if LOG_DEVICE == LOG_DVC_LOCAL_FILE
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#include <unistd.h>
+#include <thread>
+
+#include "local_log_client.h"
+#include "semaphore_sync.h"
+#include "txn.h"
+#include "txn_table.h"
+#include "manager.h"
+
+#define LOCAL_LOG_MAGIC     0x5344574cU
+// O_DIRECT needs the buffer, offset and length aligned to the block size.
+#define LOCAL_LOG_ALIGN     4096UL
+
+// Minimal io_uring with one write and one fsync in flight, set up through the
+// raw system calls. If the kernel does not support it, writes fall back to
+// pwrite and fdatasync.
+struct IOUring {
+    int                     fd;
+    unsigned *              sq_tail;
+    unsigned *              sq_mask;
+    unsigned *              sq_array;
+    io_uring_sqe *          sqes;
+    unsigned *              cq_head;
+    unsigned *              cq_tail;
+    unsigned *              cq_mask;
+    io_uring_cqe *          cqes;
+
+    bool init(uint32_t entries) {
+        io_uring_params params;
+        memset(&params, 0, sizeof(params));
+        fd = syscall(__NR_io_uring_setup, entries, &params);
+        if (fd < 0)
+            return false;
+        size_t sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        size_t cq_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        if (params.features & IORING_FEAT_SINGLE_MMAP)
+            sq_size = cq_size = std::max(sq_size, cq_size);
+        char * sq = (char *) mmap(NULL, sq_size, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+        char * cq = sq;
+        if (!(params.features & IORING_FEAT_SINGLE_MMAP))
+            cq = (char *) mmap(NULL, cq_size, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+        sqes = (io_uring_sqe *) mmap(NULL, params.sq_entries * sizeof(io_uring_sqe),
+            PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+        if (sq == MAP_FAILED || cq == MAP_FAILED || sqes == MAP_FAILED) {
+            close(fd);
+            return false;
+        }
+        sq_tail = (unsigned *) (sq + params.sq_off.tail);
+        sq_mask = (unsigned *) (sq + params.sq_off.ring_mask);
+        sq_array = (unsigned *) (sq + params.sq_off.array);
+        cq_head = (unsigned *) (cq + params.cq_off.head);
+        cq_tail = (unsigned *) (cq + params.cq_off.tail);
+        cq_mask = (unsigned *) (cq + params.cq_off.ring_mask);
+        cqes = (io_uring_cqe *) (cq + params.cq_off.cqes);
+        return true;
+    }
+
+    io_uring_sqe * next_sqe() {
+        unsigned tail = *sq_tail;
+        unsigned idx = tail & *sq_mask;
+        io_uring_sqe * sqe = &sqes[idx];
+        memset(sqe, 0, sizeof(*sqe));
+        sq_array[idx] = idx;
+        __atomic_store_n(sq_tail, tail + 1, __ATOMIC_RELEASE);
+        return sqe;
+    }
+
+    // write size bytes at offset, then fdatasync, and wait for both.
+    bool write_sync(int file, const char * buf, uint64_t size, uint64_t offset) {
+        io_uring_sqe * sqe = next_sqe();
+        sqe->opcode = IORING_OP_WRITE;
+        sqe->fd = file;
+        sqe->addr = (uint64_t) buf;
+        sqe->len = size;
+        sqe->off = offset;
+        // the fsync only starts once the write completed
+        sqe->flags = IOSQE_IO_LINK;
+        sqe = next_sqe();
+        sqe->opcode = IORING_OP_FSYNC;
+        sqe->fd = file;
+        sqe->fsync_flags = IORING_FSYNC_DATASYNC;
+        if (syscall(__NR_io_uring_enter, fd, 2, 2, IORING_ENTER_GETEVENTS,
+                    NULL, 0) < 0)
+            return false;
+        bool ok = true;
+        for (uint32_t i = 0; i < 2; i++) {
+            unsigned head = *cq_head;
+            while (head == __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE))
+                syscall(__NR_io_uring_enter, fd, 0, 1, IORING_ENTER_GETEVENTS,
+                        NULL, 0);
+            io_uring_cqe * cqe = &cqes[head & *cq_mask];
+            if (cqe->res < 0 || (i == 0 && (uint64_t) cqe->res != size))
+                ok = false;
+            __atomic_store_n(cq_head, head + 1, __ATOMIC_RELEASE);
+        }
+        return ok;
+    }
+};
+
+LocalLogClient::LocalLogClient()
+{
+    pthread_mutex_init(&_latch, NULL);
+    pthread_cond_init(&_cond, NULL);
+    for (uint32_t i = 0; i < 2; i++) {
+        _groups[i].buffer = (char *) aligned_alloc(LOCAL_LOG_ALIGN,
+                                                   LOCAL_LOG_BUFFER_SIZE);
+        _groups[i].size = 0;
+    }
+    _open = 0;
+    _fd = -1;
+    recover();
+    _ring = new IOUring;
+    if (!_ring->init(8)) {
+        delete _ring;
+        _ring = NULL;
+        cout << "[Sundial] io_uring is not available, using pwrite" << endl;
+    }
+    new std::thread(FlushGroups, this);
+    cout << "[Sundial] local file log at " << segment_name(_segment)
+         << (_direct_io? " (O_DIRECT)" : "") << endl;
+}
+
+string
+LocalLogClient::segment_name(uint32_t segment)
+{
+    return string(log_file_dir) + "/sundial-"
+        + (NODE_TYPE == STORAGE_NODE? "s" : "c") + std::to_string(g_node_id)
+        + "-" + std::to_string(segment) + ".log";
+}
+
+uint32_t
+LocalLogClient::checksum(const RecordHeader * header, const char * data)
+{
+    // FNV-1a over the header (without the checksum) and the data
+    uint32_t hash = 2166136261U;
+    const char * bytes = (const char *) header;
+    for (uint32_t i = 0; i < offsetof(RecordHeader, checksum); i++)
+        hash = (hash ^ (uint8_t) bytes[i]) * 16777619U;
+    for (uint32_t i = 0; i < header->data_size; i++)
+        hash = (hash ^ (uint8_t) data[i]) * 16777619U;
+    return hash;
+}
+
+void
+LocalLogClient::recover()
+{
+    // replay the segments in order; the last status of a txn wins. A group
+    // is padded to the block size, and a group torn by a crash ends the log.
+    uint64_t num_records = 0;
+    for (_segment = 0; ; _segment ++) {
+        int fd = open(segment_name(_segment).c_str(), O_RDONLY);
+        if (fd < 0)
+            break;
+        off_t size = lseek(fd, 0, SEEK_END);
+        char * data = (char *) mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        uint64_t offset = 0;
+        while (size > 0 && offset + sizeof(RecordHeader) <= (uint64_t) size) {
+            RecordHeader * header = (RecordHeader *) (data + offset);
+            if (header->magic != LOCAL_LOG_MAGIC) {
+                // padding up to the next group
+                offset = (offset / LOCAL_LOG_ALIGN + 1) * LOCAL_LOG_ALIGN;
+                continue;
+            }
+            if (offset + header->size > (uint64_t) size
+                || header->checksum != checksum(header, (char *) (header + 1)))
+                break;
+            if (header->flags & REC_STATUS)
+                _status[std::make_pair(header->node_id, header->id)] = header->status;
+            num_records ++;
+            offset += header->size;
+        }
+        if (size > 0)
+            munmap(data, size);
+        close(fd);
+    }
+    cout << "[Sundial] recovered " << num_records << " log records from "
+         << _segment << " segments" << endl;
+    // never append to a segment which may end with a torn group.
+    open_segment(_segment);
+}
+
+void
+LocalLogClient::open_segment(uint32_t segment)
+{
+    if (_fd >= 0)
+        close(_fd);
+    _segment = segment;
+    _segment_offset = 0;
+    string name = segment_name(segment);
+    _fd = open(name.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_DIRECT, 0644);
+    _direct_io = (_fd >= 0);
+    // e.g., tmpfs does not support O_DIRECT
+    if (_fd < 0)
+        _fd = open(name.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    M_ASSERT(_fd >= 0, "cannot open the log segment\n");
+}
+
+void
+LocalLogClient::append(uint32_t flags, uint64_t node_id, uint64_t id,
+                       int status, const string * data, std::function<void()> done)
+{
+    uint32_t data_size = data? data->size() : 0;
+    uint32_t size = (sizeof(RecordHeader) + data_size + 7) / 8 * 8;
+    M_ASSERT(size <= LOCAL_LOG_BUFFER_SIZE, "log record too large\n");
+    // wait for the flush of the other group if the open one is full.
+    while (_groups[_open].size + size > LOCAL_LOG_BUFFER_SIZE)
+        pthread_cond_wait(&_cond, &_latch);
+    Group &group = _groups[_open];
+    if (flags) {
+        RecordHeader * header = (RecordHeader *) (group.buffer + group.size);
+        memset(header, 0, size);
+        header->magic = LOCAL_LOG_MAGIC;
+        header->size = size;
+        header->flags = flags;
+        header->status = status;
+        header->node_id = node_id;
+        header->id = id;
+        header->data_size = data_size;
+        if (data_size > 0)
+            memcpy(header + 1, data->data(), data_size);
+        header->checksum = checksum(header, (char *) (header + 1));
+        group.size += size;
+    }
+    // without a record, done() still waits for the records before it.
+    group.callbacks.push_back(done);
+    pthread_cond_broadcast(&_cond);
+}
+
+int
+LocalLogClient::set_status_if_ne(uint64_t node_id, uint64_t txn_id, int status,
+                                 bool &is_set)
+{
+    auto it = _status.insert(std::make_pair(std::make_pair(node_id, txn_id), status));
+    is_set = it.second;
+    return it.first->second;
+}
+
+void
+LocalLogClient::FlushGroups(LocalLogClient * client)
+{
+    pthread_mutex_lock(&client->_latch);
+    while (true) {
+        Group * group = &client->_groups[client->_open];
+        if (group->callbacks.empty()) {
+            pthread_cond_wait(&client->_cond, &client->_latch);
+            continue;
+        }
+        // new records go to the other group while this one is written.
+        client->_open = 1 - client->_open;
+        pthread_cond_broadcast(&client->_cond);
+        pthread_mutex_unlock(&client->_latch);
+        if (group->size > 0) {
+            client->write_group(group);
+            INC_INT_STATS(num_log_group_commits, 1);
+        }
+        INC_INT_STATS(num_log_group_records, group->callbacks.size());
+        for (auto &done : group->callbacks)
+            if (done)
+                done();
+        group->callbacks.clear();
+        group->size = 0;
+        pthread_mutex_lock(&client->_latch);
+        // the group can take records again
+        pthread_cond_broadcast(&client->_cond);
+    }
+}
+
+void
+LocalLogClient::write_group(Group * group)
+{
+    // pad with zeros to the block size
+    uint64_t size = (group->size + LOCAL_LOG_ALIGN - 1) / LOCAL_LOG_ALIGN * LOCAL_LOG_ALIGN;
+    memset(group->buffer + group->size, 0, size - group->size);
+    if (_segment_offset + size > LOCAL_LOG_SEGMENT_SIZE && _segment_offset > 0)
+        open_segment(_segment + 1);
+    bool ok = false;
+    if (_ring) {
+        ok = _ring->write_sync(_fd, group->buffer, size, _segment_offset);
+        // e.g., IORING_OP_WRITE is not supported by older kernels
+        if (!ok) {
+            cout << "[Sundial] io_uring write failed, using pwrite" << endl;
+            _ring = NULL;
+        }
+    }
+    if (!_ring)
+        ok = (pwrite(_fd, group->buffer, size, _segment_offset) == (ssize_t) size)
+             && fdatasync(_fd) == 0;
+    M_ASSERT(ok, "failed to write the log\n");
+    _segment_offset += size;
+}
+
+RC
+LocalLogClient::log_sync(uint64_t node_id, uint64_t txn_id, int status) {
+    if (!glob_manager->active)
+        return FAIL;
+    uint64_t starttime = get_sys_clock();
+    SemaphoreSync sem;
+    sem.incr();
+    pthread_mutex_lock(&_latch);
+    _status[std::make_pair(node_id, txn_id)] = status;
+    append(REC_STATUS, node_id, txn_id, status, NULL, [&sem]() { sem.decr(); });
+    pthread_mutex_unlock(&_latch);
+    sem.wait();
+    INC_FLOAT_STATS(log_sync, get_sys_clock() - starttime);
+    INC_INT_STATS(num_log_sync, 1);
+    return RCOK;
+}
+
+RC
+LocalLogClient::log_async(uint64_t node_id, uint64_t txn_id, int status) {
+    if (!glob_manager->active)
+        return FAIL;
+    uint64_t starttime = get_sys_clock();
+    pthread_mutex_lock(&_latch);
+    _status[std::make_pair(node_id, txn_id)] = status;
+    append(REC_STATUS, node_id, txn_id, status, NULL, [txn_id, starttime]() {
+        TxnManager * txn = txn_table->get_txn(txn_id, false, false);
+        // mark as returned.
+        txn->rpc_log_semaphore->decr();
+        INC_FLOAT_STATS(log_async, get_sys_clock() - starttime);
+        INC_INT_STATS(num_log_async, 1);
+    });
+    pthread_mutex_unlock(&_latch);
+    return RCOK;
+}
+
+// used for termination protocol, req is always LOG_ABORT
+RC
+LocalLogClient::log_if_ne(uint64_t node_id, uint64_t txn_id) {
+    if (!glob_manager->active)
+        return FAIL;
+    uint64_t starttime = get_sys_clock();
+    bool is_set;
+    pthread_mutex_lock(&_latch);
+    int status = set_status_if_ne(node_id, txn_id, TxnManager::ABORTED, is_set);
+    append(is_set? REC_STATUS : 0, node_id, txn_id, status, NULL,
+           [txn_id, status, starttime]() {
+        TxnManager * txn = txn_table->get_txn(txn_id, false, false);
+        // default is commit, only need to set abort or committed
+        if (status == TxnManager::ABORTED) {
+            txn->set_decision(ABORT);
+        } else if (status == TxnManager::COMMITTED) {
+            txn->set_decision(COMMIT);
+        } else if (status != TxnManager::PREPARED) {
+            assert(false);
+        }
+        // mark as returned.
+        txn->rpc_log_semaphore->decr();
+        INC_FLOAT_STATS(log_if_ne, get_sys_clock() - starttime);
+        INC_INT_STATS(num_log_if_ne, 1);
+    });
+    pthread_mutex_unlock(&_latch);
+    return RCOK;
+}
+
+// used for termination protocol, a batch of txns at a time
+RC
+LocalLogClient::log_if_ne_batch(uint64_t node_id, const vector<uint64_t> & txn_ids,
+                                const std::function<void(const vector<int> &)> & callback) {
+    if (!glob_manager->active)
+        return FAIL;
+    if (txn_ids.empty())
+        return RCOK;
+    uint64_t starttime = get_sys_clock();
+    vector<int> statuses;
+    pthread_mutex_lock(&_latch);
+    for (size_t i = 0; i < txn_ids.size(); i++) {
+        bool is_set;
+        statuses.push_back(set_status_if_ne(node_id, txn_ids[i],
+                                            TxnManager::ABORTED, is_set));
+        // groups are written in order, so the last record is durable last.
+        std::function<void()> done;
+        if (i + 1 == txn_ids.size()) {
+            done = [callback, statuses, starttime]() {
+                INC_FLOAT_STATS(log_if_ne_batch, get_sys_clock() - starttime);
+                INC_INT_STATS(num_log_if_ne_batch, 1);
+                callback(statuses);
+            };
+        }
+        append(is_set? REC_STATUS : 0, node_id, txn_ids[i], statuses[i], NULL,
+               done);
+    }
+    pthread_mutex_unlock(&_latch);
+    return RCOK;
+}
+
+// used for prepare, req is always LOG_YES_REQ
+RC
+LocalLogClient::log_if_ne_data(uint64_t node_id, uint64_t txn_id, string & data) {
+    if (!glob_manager->active)
+        return FAIL;
+    uint64_t starttime = get_sys_clock();
+    bool is_set;
+    pthread_mutex_lock(&_latch);
+    int status = set_status_if_ne(node_id, txn_id, TxnManager::PREPARED, is_set);
+    append(REC_DATA | (is_set? REC_STATUS : 0), node_id, txn_id, status, &data,
+           [txn_id, status, starttime]() {
+        TxnManager * txn = txn_table->get_txn(txn_id, false, false);
+        // status can only be aborted/prepared
+        if (status == TxnManager::ABORTED)
+            txn->set_txn_state(TxnManager::ABORTED);
+        // mark as returned.
+        txn->rpc_log_semaphore->decr();
+        INC_FLOAT_STATS(log_if_ne_data, get_sys_clock() - starttime);
+        INC_INT_STATS(num_log_if_ne_data, 1);
+    });
+    pthread_mutex_unlock(&_latch);
+    return RCOK;
+}
+
+// synchronous
+RC
+LocalLogClient::log_sync_data(uint64_t node_id, uint64_t txn_id, int status,
+    string &data) {
+    if (!glob_manager->active)
+        return FAIL;
+    uint64_t starttime = get_sys_clock();
+    SemaphoreSync sem;
+    sem.incr();
+    pthread_mutex_lock(&_latch);
+    _status[std::make_pair(node_id, txn_id)] = status;
+    append(REC_STATUS | REC_DATA, node_id, txn_id, status, &data,
+           [&sem]() { sem.decr(); });
+    pthread_mutex_unlock(&_latch);
+    sem.wait();
+    INC_FLOAT_STATS(log_sync_data, get_sys_clock() - starttime);
+    INC_INT_STATS(num_log_sync_data, 1);
+    return RCOK;
+}
+
+RC
+LocalLogClient::log_async_data(uint64_t node_id, uint64_t txn_id, int status,
+                               string & data) {
+    if (!glob_manager->active)
+        return FAIL;
+    uint64_t starttime = get_sys_clock();
+    pthread_mutex_lock(&_latch);
+    _status[std::make_pair(node_id, txn_id)] = status;
+    append(REC_STATUS | REC_DATA, node_id, txn_id, status, &data,
+           [txn_id, starttime]() {
+        TxnManager * txn = txn_table->get_txn(txn_id, false, false);
+        // mark as returned.
+        txn->rpc_log_semaphore->decr();
+        INC_FLOAT_STATS(log_async, get_sys_clock() - starttime);
+        INC_INT_STATS(num_log_async, 1);
+    });
+    pthread_mutex_unlock(&_latch);
+    return RCOK;
+}
+
+RC
+LocalLogClient::log_async_batch(uint64_t node_id, const vector<uint64_t> & txn_ids,
+                                const vector<int> & statuses,
+                                const std::function<void()> & callback) {
+    if (!glob_manager->active)
+        return FAIL;
+    assert(txn_ids.size() == statuses.size());
+    if (txn_ids.empty())
+        return RCOK;
+    uint64_t starttime = get_sys_clock();
+    pthread_mutex_lock(&_latch);
+    for (size_t i = 0; i < txn_ids.size(); i++) {
+        _status[std::make_pair(node_id, txn_ids[i])] = statuses[i];
+        // groups are written in order, so the last record is durable last.
+        std::function<void()> done;
+        if (i + 1 == txn_ids.size()) {
+            done = [callback, starttime]() {
+                INC_FLOAT_STATS(log_async, get_sys_clock() - starttime);
+                INC_INT_STATS(num_log_async, 1);
+                callback();
+            };
+        }
+        append(REC_STATUS, node_id, txn_ids[i], statuses[i], NULL, done);
+    }
+    pthread_mutex_unlock(&_latch);
+    return RCOK;
+}
+
+RC
+LocalLogClient::log_entry_async(uint64_t leader_id, uint64_t index, string & data,
+                                const vector<uint64_t> & node_ids,
+                                const vector<uint64_t> & txn_ids,
+                                const vector<int> & statuses,
+                                const std::function<void()> & callback) {
+    if (!glob_manager->active)
+        return FAIL;
+    assert(node_ids.size() == txn_ids.size() && txn_ids.size() == statuses.size());
+    uint64_t starttime = get_sys_clock();
+    std::function<void()> done = [callback, starttime]() {
+        INC_FLOAT_STATS(log_async, get_sys_clock() - starttime);
+        INC_INT_STATS(num_log_async, 1);
+        callback();
+    };
+    pthread_mutex_lock(&_latch);
+    append(REC_ENTRY | REC_DATA, leader_id, index, 0, &data,
+           txn_ids.empty()? done : nullptr);
+    for (size_t i = 0; i < txn_ids.size(); i++) {
+        _status[std::make_pair(node_ids[i], txn_ids[i])] = statuses[i];
+        // groups are written in order, so the last record is durable last.
+        append(REC_STATUS, node_ids[i], txn_ids[i], statuses[i], NULL,
+               i + 1 == txn_ids.size()? done : nullptr);
+    }
+    pthread_mutex_unlock(&_latch);
+    return RCOK;
+}
+#endif
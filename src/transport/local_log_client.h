@@ -0,0 +1,104 @@
+#pragma once
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+#include "global.h"
+
+#if LOG_DEVICE == LOG_DVC_LOCAL_FILE
+
+// Log device on a local append-only file, with the same interface as
+// RedisClient. The file is split in segments of LOCAL_LOG_SEGMENT_SIZE named
+// <log dir>/sundial-<node type><node id>-<segment>.log.
+// Records are group committed by a flush thread: all records appended while
+// a group is being flushed form the next group, which is written with O_DIRECT
+// through io_uring and made durable with fdatasync. Async calls complete once
+// their group is durable.
+// The latest status of each (node, txn) is kept in memory, so the
+// conditional writes (log_if_ne*) are resolved without reading the file. On
+// startup, the index is rebuilt from the segments.
+class LocalLogClient {
+  public:
+    LocalLogClient();
+    RC log_sync(uint64_t node_id, uint64_t txn_id, int status);
+    RC log_async(uint64_t node_id, uint64_t txn_id, int status);
+    RC log_if_ne(uint64_t node_id, uint64_t txn_id);
+    // log_if_ne for many txns of node_id at once. callback gets the
+    // resulting status of each txn, in order, once they are durable.
+    RC log_if_ne_batch(uint64_t node_id, const std::vector<uint64_t> & txn_ids,
+        const std::function<void(const std::vector<int> &)> & callback);
+    RC log_if_ne_data(uint64_t node_id, uint64_t txn_id, std::string & data);
+    RC log_sync_data(uint64_t node_id, uint64_t txn_id, int status,
+        std::string & data);
+    RC log_async_data(uint64_t node_id, uint64_t txn_id, int status,
+        std::string & data);
+    // set the status of many txns of node_id at once. callback runs once
+    // all of them are durable.
+    RC log_async_batch(uint64_t node_id, const std::vector<uint64_t> & txn_ids,
+        const std::vector<int> & statuses, const std::function<void()> & callback);
+    // [PAXOS] write an entry of the replicated log of leader_id, and set the
+    // status of the txn of each of its records. callback runs on the flush thread
+    // once they are durable.
+    RC log_entry_async(uint64_t leader_id, uint64_t index, std::string & data,
+        const std::vector<uint64_t> & node_ids,
+        const std::vector<uint64_t> & txn_ids,
+        const std::vector<int> & statuses, const std::function<void()> & callback);
+
+    static void FlushGroups(LocalLogClient * client);
+
+  private:
+    enum RecordFlag {
+        REC_STATUS = 1,
+        REC_DATA   = 2,
+        REC_ENTRY  = 4
+    };
+    struct RecordHeader {
+        uint32_t    magic;
+        // of the header, data and padding to 8 bytes
+        uint32_t    size;
+        uint32_t    flags;
+        int32_t     status;
+        uint64_t    node_id;
+        // txn id, or index of an entry
+        uint64_t    id;
+        uint32_t    data_size;
+        uint32_t    checksum;
+    };
+    struct Group {
+        char *                              buffer;
+        uint64_t                            size;
+        vector<std::function<void()> >      callbacks;
+    };
+    static uint32_t checksum(const RecordHeader * header, const char * data);
+    // add a record to the open group; done() (if set) runs once it is durable.
+    // Called with _latch held.
+    void        append(uint32_t flags, uint64_t node_id, uint64_t id,
+                       int status, const std::string * data,
+                       std::function<void()> done);
+    // set the status unless one exists, and return the resulting status.
+    // Called with _latch held.
+    int         set_status_if_ne(uint64_t node_id, uint64_t txn_id, int status,
+                                 bool &is_set);
+
+    string      segment_name(uint32_t segment);
+    void        recover();
+    void        open_segment(uint32_t segment);
+    void        write_group(Group * group);
+
+    pthread_mutex_t     _latch;
+    pthread_cond_t      _cond;
+    // _groups[_open] takes new records while the other one is flushed.
+    Group               _groups[2];
+    uint32_t            _open;
+    std::map<std::pair<uint64_t, uint64_t>, int> _status;
+
+    // only used by the flush thread (and recover())
+    int                 _fd;
+    bool                _direct_io;
+    uint32_t            _segment;
+    uint64_t            _segment_offset;
+    struct IOUring *    _ring;
+};
+
+#endif
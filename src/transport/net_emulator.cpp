@@ -0,0 +1,136 @@
+#include <fstream>
+#include <sstream>
+#include "net_emulator.h"
+#include "helper.h"
+
+NetEmulator::NetEmulator()
+{
+    pthread_mutex_init(&_latch, NULL);
+    _wheel = new vector<Message> [NET_EMU_WHEEL_SIZE];
+    _curr_tick = get_sys_clock() / (NET_EMU_TICK * 1000UL);
+    _link_free_time.resize((g_num_nodes + g_num_storage_nodes) * 2, 0);
+    load_delays();
+    _rng.seed(g_node_id);
+    _thread = new std::thread(Run, this);
+}
+
+uint32_t
+NetEmulator::get_link(uint64_t node_id, bool is_storage, bool is_outgoing)
+{
+    uint32_t link = is_storage? g_num_nodes + node_id : node_id;
+    assert(link < g_num_nodes + g_num_storage_nodes);
+    return link * 2 + (is_outgoing? 0 : 1);
+}
+
+void
+NetEmulator::load_delays()
+{
+    uint32_t num_nodes = g_num_nodes + g_num_storage_nodes;
+    uint32_t self = (NODE_TYPE == STORAGE_NODE)? g_num_nodes + g_node_id : g_node_id;
+    vector<vector<uint64_t> > matrix(num_nodes, vector<uint64_t>(num_nodes));
+    for (uint32_t i = 0; i < num_nodes; i++)
+        for (uint32_t j = 0; j < num_nodes; j++) {
+            matrix[i][j] = NET_EMU_LATENCY;
+#if LOG_DELAY > 0
+            // compute node i and storage node i are in the same region.
+            bool same_region = (i < g_num_nodes && j == g_num_nodes + i)
+                               || (j < g_num_nodes && i == g_num_nodes + j);
+            if (!same_region || UNIFORM_DELAY)
+                matrix[i][j] = LOG_DELAY / 2;
+#endif
+        }
+#if NET_EMU_DELAY_MATRIX
+    std::ifstream in(delay_matrix_file);
+    M_ASSERT(in.good(), "cannot open the delay matrix file\n");
+    string line;
+    uint32_t row = 0;
+    while (row < num_nodes && getline(in, line)) {
+        if (line.empty() || line[0] == '#')
+            continue;
+        std::istringstream values(line);
+        for (uint32_t j = 0; j < num_nodes; j++) {
+            values >> matrix[row][j];
+            M_ASSERT(!values.fail(), "delay matrix: missing latency\n");
+        }
+        row ++;
+    }
+    M_ASSERT(row == num_nodes, "delay matrix: missing row\n");
+#endif
+    _link_delay.resize(num_nodes * 2);
+    for (uint32_t i = 0; i < num_nodes; i++) {
+        _link_delay[i * 2] = matrix[self][i] * 1000UL;
+        _link_delay[i * 2 + 1] = matrix[i][self] * 1000UL;
+    }
+}
+
+uint64_t
+NetEmulator::get_arrival_time(uint64_t node_id, bool is_storage,
+                              bool is_outgoing, uint64_t size)
+{
+    uint32_t link = get_link(node_id, is_storage, is_outgoing);
+    uint64_t now = get_sys_clock();
+    uint64_t sent_time = now;
+    pthread_mutex_lock(&_latch);
+#if NET_EMU_BANDWIDTH > 0
+    // the message waits for those before it on the link.
+    uint64_t &free_time = _link_free_time[link];
+    sent_time = std::max(now, free_time) + size * 8 * 1000 / NET_EMU_BANDWIDTH;
+    free_time = sent_time;
+#endif
+    uint64_t delay = _link_delay[link];
+#if NET_EMU_JITTER > 0
+    delay += _rng() % (NET_EMU_JITTER * 1000UL);
+#endif
+    pthread_mutex_unlock(&_latch);
+    return sent_time + delay;
+}
+
+void
+NetEmulator::delay(uint64_t node_id, bool is_storage, bool is_outgoing,
+                   uint64_t size, std::function<void()> deliver)
+{
+    uint64_t arrival_time = get_arrival_time(node_id, is_storage, is_outgoing, size);
+    // round up, so that a message is never released early.
+    uint64_t tick = (arrival_time + NET_EMU_TICK * 1000UL - 1) / (NET_EMU_TICK * 1000UL);
+    pthread_mutex_lock(&_latch);
+    // a tick already passed is released with the next one.
+    tick = std::max(tick, _curr_tick + 1);
+    _wheel[tick % NET_EMU_WHEEL_SIZE].push_back(Message {tick, deliver});
+    pthread_mutex_unlock(&_latch);
+}
+
+void
+NetEmulator::Run(NetEmulator * emu)
+{
+    vector<Message> due;
+    while (true) {
+        uint64_t now_tick = get_sys_clock() / (NET_EMU_TICK * 1000UL);
+        if (now_tick <= emu->_curr_tick) {
+            usleep(NET_EMU_TICK);
+            continue;
+        }
+        pthread_mutex_lock(&emu->_latch);
+        while (emu->_curr_tick < now_tick) {
+            emu->_curr_tick ++;
+            vector<Message> &slot = emu->_wheel[emu->_curr_tick % NET_EMU_WHEEL_SIZE];
+            if (slot.empty())
+                continue;
+            uint32_t size = 0;
+            for (uint32_t i = 0; i < slot.size(); i++) {
+                if (slot[i].tick <= emu->_curr_tick)
+                    due.push_back(std::move(slot[i]));
+                else {
+                    if (i != size)
+                        slot[size] = std::move(slot[i]);
+                    size ++;
+                }
+            }
+            slot.resize(size);
+        }
+        pthread_mutex_unlock(&emu->_latch);
+        // deliver without the latch; the actions may send more messages.
+        for (auto &msg : due)
+            msg.deliver();
+        due.clear();
+    }
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <functional>
+#include <random>
+#include <thread>
+#include "global.h"
+
+#define NET_EMULATION (NET_EMU_LATENCY > 0 || NET_EMU_JITTER > 0 \
+                       || NET_EMU_BANDWIDTH > 0 || NET_EMU_DELAY_MATRIX \
+                       || LOG_DELAY > 0)
+// the timer wheel covers NET_EMU_WHEEL_SIZE ticks; a message due later stays
+// in its slot for more than one turn.
+#define NET_EMU_WHEEL_SIZE 8192
+
+// Emulated network between this node and the others. A message is handed
+// over with the action that sends or delivers it; the action runs on the
+// emulator thread once the message would have crossed the link, so no rpc
+// thread is held during the delay.
+// A link is one direction between this node and a compute or storage node.
+// Its one-way latency comes from the delay matrix, whose rows and columns are
+// the compute nodes followed by the storage nodes, in us:
+//      # from \ to   node-0  node-1  storage-0
+//      0             100     500
+//      100           0       20
+//      500           20      0
+class NetEmulator
+{
+public:
+    NetEmulator();
+
+    // time (from get_sys_clock) at which a message of size bytes arrives.
+    uint64_t    get_arrival_time(uint64_t node_id, bool is_storage,
+                                 bool is_outgoing, uint64_t size);
+    // run deliver() when the message arrives.
+    void        delay(uint64_t node_id, bool is_storage, bool is_outgoing,
+                      uint64_t size, std::function<void()> deliver);
+    static void Run(NetEmulator * emu);
+
+private:
+    struct Message {
+        uint64_t                tick;
+        std::function<void()>   deliver;
+    };
+    uint32_t    get_link(uint64_t node_id, bool is_storage, bool is_outgoing);
+    void        load_delays();
+
+    pthread_mutex_t         _latch;
+    // slot i holds the messages due at the ticks equal to i modulo the
+    // wheel size, in the order they were sent.
+    vector<Message> *       _wheel;
+    // the messages of all ticks up to _curr_tick are delivered
+    uint64_t                _curr_tick;
+    // one-way latency of each link, in ns
+    vector<uint64_t>        _link_delay;
+    // time at which each link finishes transmitting what it was given
+    vector<uint64_t>        _link_free_time;
+    std::mt19937_64         _rng;
+    std::thread *           _thread;
+};
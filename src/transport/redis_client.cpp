@@ -11,10 +11,37 @@
 
 #if LOG_DEVICE == LOG_DVC_REDIS || LOG_DEVICE == LOG_DVC_CUSTOMIZED
 
-void async_callback(cpp_redis::reply & response);
-void ne_callback(cpp_redis::reply & response);
-void tp_callback(cpp_redis::reply & response);
-void sync_callback(cpp_redis::reply & response);
+const char * RedisClient::script_source[NUM_SCRIPTS] = {
+    // SCRIPT_STATUS_NX
+    R"(
+        redis.call('set', KEYS[1], ARGV[1], 'NX')
+        return tonumber(redis.call('get', KEYS[1]))
+    )",
+    // SCRIPT_DATA_STATUS_NX
+    R"(
+        redis.call('set', KEYS[1], ARGV[1])
+        redis.call('set', KEYS[2], ARGV[2], 'NX')
+        return tonumber(redis.call('get', KEYS[2]))
+    )",
+    // SCRIPT_STATUS_NX_BATCH
+    R"(
+        local states = {}
+        for i = 1, #KEYS do
+            redis.call('set', KEYS[i], ARGV[1], 'NX')
+            states[i] = tonumber(redis.call('get', KEYS[i]))
+        end
+        return states
+    )"
+};
+
+string
+RedisClient::pack_key(char type, uint64_t node_id, uint64_t id) {
+    string key(1 + sizeof(uint32_t) + sizeof(uint64_t), type);
+    uint32_t node = node_id;
+    memcpy(&key[1], &node, sizeof(uint32_t));
+    memcpy(&key[1 + sizeof(uint32_t)], &id, sizeof(uint64_t));
+    return key;
+}
 
 RedisClient::RedisClient() {
     tls = LOG_TLS_REDIS;
@@ -53,81 +80,37 @@ RedisClient::RedisClient() {
             });
         }
     }
-    clients[0]->flushall(sync_callback);
+    clients[0]->flushall([](cpp_redis::reply & response) {});
+    // SCRIPT LOAD is idempotent and the scripts survive FLUSHALL.
+    for (uint32_t i = 0; i < NUM_SCRIPTS; i++) {
+        clients[0]->script_load(script_source[i],
+                                [this, i](cpp_redis::reply & response) {
+            M_ASSERT(response.is_string(), "failed to load a redis script\n");
+            script_sha[i] = response.as_string();
+        });
+    }
     clients[0]->sync_commit();
     std::cout << "[Sundial] connected to redis server!" << std::endl;
 }
 
 
-void 
-sync_callback(cpp_redis::reply & response) {
-}
-
-void 
-async_callback(cpp_redis::reply & response) {
-    assert(response.is_array());
-    TxnManager * txn = txn_table->get_txn(response.as_array()[0].as_integer(),
-        false, false);
-    uint64_t starttime = response.as_array()[1].as_integer();
-    // mark as returned. 
+// callback of the async writes whose txn waits on rpc_log_semaphore
+static void
+async_callback(uint64_t txn_id, uint64_t starttime) {
+    TxnManager * txn = txn_table->get_txn(txn_id, false, false);
+    // mark as returned.
     txn->rpc_log_semaphore->decr();
     INC_FLOAT_STATS(log_async, get_sys_clock() - starttime);
     INC_INT_STATS(num_log_async, 1);
 }
 
-void 
-ne_callback(cpp_redis::reply & response) {
-    assert(response.is_array());
-    TxnManager::State state = (TxnManager::State) response.as_array()[0].as_integer();
-    uint64_t txnid = response.as_array()[1].as_integer();
-    uint64_t starttime = response.as_array()[2].as_integer();
-    TxnManager * txn = txn_table->get_txn(txnid, false, false);
-    
-    // status can only be aborted/prepared
-    if (state == TxnManager::ABORTED)
-        txn->set_txn_state(TxnManager::ABORTED);
-    // mark as returned. 
-    txn->rpc_log_semaphore->decr();
-    INC_FLOAT_STATS(log_if_ne_data, get_sys_clock() - starttime);
-    INC_INT_STATS(num_log_if_ne_data, 1);
-}
-
-// termination protocol callback
-void
-tp_callback(cpp_redis::reply & response) {
-    assert(response.is_array());
-    TxnManager::State state = (TxnManager::State) response.as_array()[0].as_integer();
-    TxnManager * txn = txn_table->get_txn(response.as_array()[1].as_integer()
-        , false, false);
-    uint64_t starttime = response.as_array()[2].as_integer();
-    // default is commit, only need to set abort or committed
-    if (state == TxnManager::ABORTED) {
-        txn->set_decision(ABORT);
-    } else if (state == TxnManager::COMMITTED) {
-        txn->set_decision(COMMIT);
-    } else if (state != TxnManager::PREPARED) {
-		assert(false);
-	}
-    // mark as returned.
-    txn->rpc_log_semaphore->decr();
-    INC_FLOAT_STATS(log_if_ne, get_sys_clock() - starttime);
-    INC_INT_STATS(num_log_if_ne, 1);
-}
-
 RC
 RedisClient::log_sync(uint64_t node_id, uint64_t txn_id, int status) {
     if (!glob_manager->active)
         return FAIL;
     uint64_t starttime = get_sys_clock();
-    auto script = R"(
-        redis.call('set', KEYS[1], ARGV[1])
-        return tonumber(ARGV[2])
-        )";
-    string id = std::to_string(node_id) + "-" + std::to_string(txn_id);
-    std::vector<std::string> keys = {"status-" + id};
-    std::vector<std::string> args = {std::to_string(status),
-                                     std::to_string(txn_id)};
-    clients[0]->eval(script, keys, args, sync_callback);
+    clients[0]->set(pack_key('s', node_id, txn_id), pack_status(status),
+                    [](cpp_redis::reply & response) {});
     clients[0]->sync_commit();
     INC_FLOAT_STATS(log_sync, get_sys_clock() - starttime);
     INC_INT_STATS(num_log_sync, 1);
@@ -139,16 +122,10 @@ RedisClient::log_async(uint64_t node_id, uint64_t txn_id, int status) {
     if (!glob_manager->active)
         return FAIL;
     uint64_t starttime = get_sys_clock();
-    auto script = R"(
-        redis.call('set', KEYS[1], ARGV[1])
-        return {tonumber(ARGV[2]), tonumber(ARGV[3])}
-        )";
-    string tid = std::to_string(txn_id);
-    string id = std::to_string(node_id) + "-" + tid;
-    std::vector<std::string> keys = {"status-" + id};
-    std::vector<std::string> args = {std::to_string(status), tid,
-                                     std::to_string(starttime)};
-    clients[0]->eval(script, keys, args, async_callback);
+    clients[0]->set(pack_key('s', node_id, txn_id), pack_status(status),
+                    [txn_id, starttime](cpp_redis::reply & response) {
+        async_callback(txn_id, starttime);
+    });
     clients[0]->commit();
     return RCOK;
 }
@@ -159,19 +136,52 @@ RedisClient::log_if_ne(uint64_t node_id, uint64_t txn_id) {
     if (!glob_manager->active)
         return FAIL;
     uint64_t starttime = get_sys_clock();
-    // log format - key-value
-    // key: "type(data/status)-node_id-txn_id"
-    auto script = R"(
-        redis.call('setnx', KEYS[1], ARGV[1])
-        local status = tonumber(redis.call('get', KEYS[1]))
-        return {tonumber(status), tonumber(ARGV[2]), tonumber(ARGV[3])}
-    )";
-    string tid = std::to_string(txn_id);
-    string key = "status" + std::to_string(node_id) + "-" + std::to_string(txn_id);
-    std::vector<std::string> keys = {key};
-    std::vector<std::string> args = {std::to_string(TxnManager::ABORTED),
-                                     tid, std::to_string(starttime)};
-    clients[0]->eval(script, keys, args, tp_callback);
+    std::vector<std::string> keys = {pack_key('s', node_id, txn_id)};
+    std::vector<std::string> args = {pack_status(TxnManager::ABORTED)};
+    clients[0]->evalsha(script_sha[SCRIPT_STATUS_NX], keys, args,
+                        [txn_id, starttime](cpp_redis::reply & response) {
+        TxnManager::State state = (TxnManager::State) response.as_integer();
+        TxnManager * txn = txn_table->get_txn(txn_id, false, false);
+        // default is commit, only need to set abort or committed
+        if (state == TxnManager::ABORTED) {
+            txn->set_decision(ABORT);
+        } else if (state == TxnManager::COMMITTED) {
+            txn->set_decision(COMMIT);
+        } else if (state != TxnManager::PREPARED) {
+            assert(false);
+        }
+        // mark as returned.
+        txn->rpc_log_semaphore->decr();
+        INC_FLOAT_STATS(log_if_ne, get_sys_clock() - starttime);
+        INC_INT_STATS(num_log_if_ne, 1);
+    });
+    clients[0]->commit();
+    return RCOK;
+}
+
+// used for termination protocol, a batch of txns at a time
+RC
+RedisClient::log_if_ne_batch(uint64_t node_id, const std::vector<uint64_t> & txn_ids,
+                             const std::function<void(const std::vector<int> &)> & callback) {
+    if (!glob_manager->active)
+        return FAIL;
+    if (txn_ids.empty())
+        return RCOK;
+    uint64_t starttime = get_sys_clock();
+    std::vector<std::string> keys;
+    keys.reserve(txn_ids.size());
+    for (auto txn_id : txn_ids)
+        keys.push_back(pack_key('s', node_id, txn_id));
+    std::vector<std::string> args = {pack_status(TxnManager::ABORTED)};
+    clients[0]->evalsha(script_sha[SCRIPT_STATUS_NX_BATCH], keys, args,
+                        [callback, starttime](cpp_redis::reply & response) {
+        std::vector<int> statuses;
+        for (auto & state : response.as_array())
+            statuses.push_back(state.as_integer());
+        INC_FLOAT_STATS(log_if_ne_batch, get_sys_clock() - starttime);
+        INC_INT_STATS(num_log_if_ne_batch, 1);
+        callback(statuses);
+    });
     clients[0]->commit();
     return RCOK;
 }
@@ -182,19 +192,21 @@ RedisClient::log_if_ne_data(uint64_t node_id, uint64_t txn_id, string & data) {
     if (!glob_manager->active)
         return FAIL;
     uint64_t starttime = get_sys_clock();
-    // log format - key-value
-    // key: "type(data/status)-node_id-txn_id"
-    auto script = R"(
-        redis.call('set', KEYS[1], ARGV[1])
-        redis.call('setnx', KEYS[2], ARGV[2])
-        local status = tonumber(redis.call('get', KEYS[2]))
-        return {tonumber(status), tonumber(ARGV[3]), tonumber(ARGV[4])};)";
-    string tid = std::to_string(txn_id);
-    string id = std::to_string(node_id) + "-" + tid;
-    std::vector<std::string> keys = {"data-" + id, "status" + id};
-    std::vector<std::string> args = {data, std::to_string(TxnManager::PREPARED),
-                                     tid, std::to_string(starttime)};
-    clients[0]->eval(script, keys, args, ne_callback);
+    std::vector<std::string> keys = {pack_key('d', node_id, txn_id),
+                                     pack_key('s', node_id, txn_id)};
+    std::vector<std::string> args = {data, pack_status(TxnManager::PREPARED)};
+    clients[0]->evalsha(script_sha[SCRIPT_DATA_STATUS_NX], keys, args,
+                        [txn_id, starttime](cpp_redis::reply & response) {
+        TxnManager::State state = (TxnManager::State) response.as_integer();
+        TxnManager * txn = txn_table->get_txn(txn_id, false, false);
+        // status can only be aborted/prepared
+        if (state == TxnManager::ABORTED)
+            txn->set_txn_state(TxnManager::ABORTED);
+        // mark as returned.
+        txn->rpc_log_semaphore->decr();
+        INC_FLOAT_STATS(log_if_ne_data, get_sys_clock() - starttime);
+        INC_INT_STATS(num_log_if_ne_data, 1);
+    });
     clients[0]->commit();
     return RCOK;
 }
@@ -206,20 +218,12 @@ RedisClient::log_sync_data(uint64_t node_id, uint64_t txn_id, int status,
     if (!glob_manager->active)
         return FAIL;
     uint64_t starttime = get_sys_clock();
-    // log format - key-value
-    // key: "type(data/status)-node_id-txn_id"
-    auto script = R"(
-        redis.call('set', KEYS[1], ARGV[1])
-        redis.call('set', KEYS[2], ARGV[2])
-        return tonumber(ARGV[3])
-    )";
-    string tid = std::to_string(txn_id);
-    string id = std::to_string(node_id) + "-" + tid;
-    std::vector<std::string> keys = {"data-" + id, "status" + id};
-    std::vector<std::string> args = {data,
-                                     std::to_string(status),
-									 tid};
-    clients[0]->eval(script, keys, args, sync_callback);
+    // MSET writes the data and the status atomically.
+    std::vector<std::string> command = {"MSET", pack_key('d', node_id, txn_id), data,
+                                        pack_key('s', node_id, txn_id),
+                                        pack_status(status)};
+    clients[0]->send(command,
+                     [](cpp_redis::reply & response) {});
     clients[0]->sync_commit();
     INC_FLOAT_STATS(log_sync_data, get_sys_clock() - starttime);
     INC_INT_STATS(num_log_sync_data, 1);
@@ -232,19 +236,68 @@ RedisClient::log_async_data(uint64_t node_id, uint64_t txn_id, int status,
     if (!glob_manager->active)
         return FAIL;
     uint64_t starttime = get_sys_clock();
-    // log format - key-value
-    // key: "type(data/status)-node_id-txn_id"
-    auto script = R"(
-        redis.call('set', KEYS[1], ARGV[1])
-        redis.call('set', KEYS[2], ARGV[2])
-        return {tonumber(ARGV[3]), tonumber(ARGV[4])}
-    )";
-    string tid = std::to_string(txn_id);
-    string id = std::to_string(node_id) + "-" + tid;
-    std::vector<std::string> keys = {"data-" + id, "status" + id};
-    std::vector<std::string> args = {data, std::to_string(status),
-                                     tid, std::to_string(starttime)};
-    clients[0]->eval(script, keys, args, async_callback);
+    std::vector<std::string> command = {"MSET", pack_key('d', node_id, txn_id), data,
+                                        pack_key('s', node_id, txn_id),
+                                        pack_status(status)};
+    clients[0]->send(command,
+                     [txn_id, starttime](cpp_redis::reply & response) {
+        async_callback(txn_id, starttime);
+    });
+    clients[0]->commit();
+    return RCOK;
+}
+
+RC
+RedisClient::log_async_batch(uint64_t node_id, const std::vector<uint64_t> & txn_ids,
+                             const std::vector<int> & statuses,
+                             const std::function<void()> & callback) {
+    if (!glob_manager->active)
+        return FAIL;
+    assert(txn_ids.size() == statuses.size());
+    if (txn_ids.empty())
+        return RCOK;
+    uint64_t starttime = get_sys_clock();
+    std::vector<std::string> command;
+    command.reserve(1 + 2 * txn_ids.size());
+    command.push_back("MSET");
+    for (size_t i = 0; i < txn_ids.size(); i++) {
+        command.push_back(pack_key('s', node_id, txn_ids[i]));
+        command.push_back(pack_status(statuses[i]));
+    }
+    clients[0]->send(command, [callback, starttime](cpp_redis::reply & response) {
+        INC_FLOAT_STATS(log_async, get_sys_clock() - starttime);
+        INC_INT_STATS(num_log_async, 1);
+        callback();
+    });
+    clients[0]->commit();
+    return RCOK;
+}
+
+RC
+RedisClient::log_entry_async(uint64_t leader_id, uint64_t index, string & data,
+                             const std::vector<uint64_t> & node_ids,
+                             const std::vector<uint64_t> & txn_ids,
+                             const std::vector<int> & statuses,
+                             const std::function<void()> & callback) {
+    if (!glob_manager->active)
+        return FAIL;
+    assert(node_ids.size() == txn_ids.size() && txn_ids.size() == statuses.size());
+    uint64_t starttime = get_sys_clock();
+    // MSET writes the entry and applies its records atomically.
+    std::vector<std::string> command;
+    command.reserve(3 + 2 * txn_ids.size());
+    command.push_back("MSET");
+    command.push_back(pack_key('e', leader_id, index));
+    command.push_back(data);
+    for (size_t i = 0; i < txn_ids.size(); i++) {
+        command.push_back(pack_key('s', node_ids[i], txn_ids[i]));
+        command.push_back(pack_status(statuses[i]));
+    }
+    clients[0]->send(command, [callback, starttime](cpp_redis::reply & response) {
+        INC_FLOAT_STATS(log_async, get_sys_clock() - starttime);
+        INC_INT_STATS(num_log_async, 1);
+        callback();
+    });
     clients[0]->commit();
     return RCOK;
 }
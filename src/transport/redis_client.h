@@ -6,7 +6,9 @@
 #define SUNDIAL_TRANSPORT_REDIS_CLIENT_H_
 
 #include <cpp_redis/cpp_redis>
+#include <functional>
 #include <string>
+#include <vector>
 
 #include "helper.h"
 #include "config.h"
@@ -19,13 +21,49 @@ class RedisClient {
     RC log_sync(uint64_t node_id, uint64_t txn_id, int status);
     RC log_async(uint64_t node_id, uint64_t txn_id, int status);
     RC log_if_ne(uint64_t node_id, uint64_t txn_id);
+    // log_if_ne for many txns of node_id at once. callback gets the
+    // resulting status of each txn, in order.
+    RC log_if_ne_batch(uint64_t node_id, const std::vector<uint64_t> & txn_ids,
+        const std::function<void(const std::vector<int> &)> & callback);
     RC log_if_ne_data(uint64_t node_id, uint64_t txn_id, std::string & data);
     RC log_sync_data(uint64_t node_id, uint64_t txn_id, int status,
         std::string & data);
     RC log_async_data(uint64_t node_id, uint64_t txn_id, int status,
         std::string & data);
+    // set the status of many txns of node_id at once. callback runs once
+    // all of them are written.
+    RC log_async_batch(uint64_t node_id, const std::vector<uint64_t> & txn_ids,
+        const std::vector<int> & statuses, const std::function<void()> & callback);
+    // [PAXOS] write an entry of the replicated log of leader_id, and set the
+    // status of the txn of each of its records. callback runs on the redis client thread
+    // once they are durable.
+    RC log_entry_async(uint64_t leader_id, uint64_t index, std::string & data,
+        const std::vector<uint64_t> & node_ids,
+        const std::vector<uint64_t> & txn_ids,
+        const std::vector<int> & statuses, const std::function<void()> & callback);
   private:
+    // conditional writes run as Lua scripts loaded once at startup and
+    // invoked by their SHA1 (EVALSHA).
+    enum Script {
+        // set KEYS[1] to ARGV[1] if absent, return its status
+        SCRIPT_STATUS_NX,
+        // set KEYS[1] (data) to ARGV[1], KEYS[2] (status) to ARGV[2] if
+        // absent, return the status
+        SCRIPT_DATA_STATUS_NX,
+        // SCRIPT_STATUS_NX for each of KEYS, return their statuses
+        SCRIPT_STATUS_NX_BATCH,
+        NUM_SCRIPTS
+    };
+    static const char * script_source[NUM_SCRIPTS];
+    // key: 1-byte type ('s'tatus, 'd'ata, 'e'ntry), then node id and txn id
+    // (or entry index) in binary.
+    static std::string pack_key(char type, uint64_t node_id, uint64_t id);
+    static std::string pack_status(int status) {
+        return std::string(1, (char) ('0' + status));
+    }
+
     cpp_redis::client* clients[NUM_WORKER_THREADS];
+    std::string script_sha[NUM_SCRIPTS];
     bool tls;
 };
 
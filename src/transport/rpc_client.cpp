@@ -1,5 +1,7 @@
 #include "global.h"
 #include "rpc_client.h"
+#include "paxos_log.h"
+#include "failure_detector.h"
 #include "stats.h"
 #include "manager.h"
 #include "txn.h"
@@ -8,8 +10,12 @@
 SundialRPCClient::SundialRPCClient() {
     _servers = new SundialRPCClientStub * [g_num_nodes];
     _storage_servers = new SundialRPCClientStub * [g_num_storage_nodes];
-    _threads = new std::thread * [g_num_nodes];
-    _storage_threads = new std::thread * [g_num_storage_nodes];
+    _threads = new std::thread * [g_num_nodes * NUM_RPC_CLIENT_CQS];
+    _storage_threads = new std::thread * [g_num_storage_nodes * NUM_RPC_CLIENT_CQS];
+    _num_cq_threads = 0;
+#if NET_EMULATION
+    _net_emu = new NetEmulator();
+#endif
     // get server names
     std::ifstream in(ifconfig_file);
     string line;
@@ -30,10 +36,11 @@ SundialRPCClient::SundialRPCClient() {
 #endif
             _servers[node_id] = new SundialRPCClientStub(grpc::CreateChannel(url,
                 grpc::InsecureChannelCredentials()));
-            // spawn a reader thread for each server to indefinitely read completion
-            // queue
-            _threads[node_id] = new std::thread(AsyncCompleteRpc,
-                                                        this, node_id);
+            // spawn reader threads for each server to indefinitely read its
+            // completion queues
+            for (uint32_t i = 0; i < NUM_RPC_CLIENT_CQS; i++)
+                _threads[node_id * NUM_RPC_CLIENT_CQS + i] =
+                    start_cq_thread(false, node_id, i);
             cout << "[Sundial] init rpc client to - " << node_id << " at " <<
                 url << endl;
             node_id ++;
@@ -60,70 +67,143 @@ SundialRPCClient::SundialRPCClient() {
 #endif
         _storage_servers[node_id] = new SundialRPCClientStub
           (grpc::CreateChannel(line, grpc::InsecureChannelCredentials()));
-        // spawn a reader thread for each server to indefinitely read completion
-        // queue
-        _storage_threads[node_id] = new std::thread(AsyncCompleteRpcStorage,
-                                                    this, node_id);
+        // spawn reader threads for each server to indefinitely read its
+        // completion queues
+        for (uint32_t i = 0; i < NUM_RPC_CLIENT_CQS; i++)
+            _storage_threads[node_id * NUM_RPC_CLIENT_CQS + i] =
+                start_cq_thread(true, node_id, i);
         cout << "[Sundial] init rpc storage client - " << node_id << " at " <<
         line << endl;
         node_id ++;
       }
     }
+#endif
+#if RPC_BATCHING
+    _batches = new RPCBatch * [g_num_nodes];
+    for (uint32_t i = 0; i < g_num_nodes; i++) {
+        _batches[i] = new RPCBatch;
+        pthread_mutex_init(&_batches[i]->mutex, NULL);
+        _batches[i]->start_time = 0;
+    }
+    _flush_thread = new std::thread(FlushBatches, this);
 #endif
     cout << "[Sundial] rpc client is initialized!" << endl;
 }
 
 
+std::thread *
+SundialRPCClient::start_cq_thread(bool is_storage, uint64_t node_id,
+                                  uint32_t cq_id) {
+    std::thread * thd;
+    if (is_storage)
+        thd = new std::thread(AsyncCompleteRpcStorage, this, node_id, cq_id);
+    else
+        thd = new std::thread(AsyncCompleteRpc, this, node_id, cq_id);
+#if PIN_RPC_THREADS
+    // use the cores after those of the rpc server threads
+    pin_thread(thd, NUM_RPC_SERVER_THREADS + _num_cq_threads);
+#endif
+    _num_cq_threads ++;
+    return thd;
+}
+
 void
 SundialRPCClient::AsyncCompleteRpcStorage(SundialRPCClient * s, uint64_t
-node_id) {
+node_id, uint32_t cq_id) {
     void* got_tag;
     bool ok = false;
     // Block until the next result is available in the completion queue "cq".
     while (true) {
-        s->_storage_servers[node_id]->cq_.Next(&got_tag, &ok);
+        s->_storage_servers[node_id]->cqs_[cq_id].Next(&got_tag, &ok);
         // The tag in this example is the memory location of the call object
         auto call = static_cast<AsyncClientCall*>(got_tag);
         if (!call->status.ok()) {
             printf("[REQ] client rec response fail: (%d) %s\n",
                    call->status.error_code(), call->status.error_message().c_str());
             // assert(false);
+            // [PAXOS] the peer did not accept the entry
+            if (call->request->request_type() == SundialRequest::PAXOS_REPLICATE)
+                paxos_log->ack(call->request->log_index(), false);
+#if FAILURE_DETECTOR
+            // [FAILURE DETECTOR] the heartbeat expired; the next one is sent.
+            if (call->request->request_type() == SundialRequest::HEARTBEAT) {
+                failure_detector->heartbeat_failed(call->request->receiver_id());
+                delete call;
+            }
+#endif
             continue;
         }
-        // handle return value for non-system response
-        assert(call->reply->response_type() != SundialResponse::SYS_RESP);
-        s->sendRequestDone(call->request, call->reply);
-        // Once we're complete, deallocate the call object.
-        delete call;
+#if ZERO_COPY_TUPLES
+        if (call->raw_reader)
+            parseRawReply(call);
+#endif
+#if NET_EMULATION
+        // the reply still has to come back over the emulated link.
+        s->_net_emu->delay(node_id, true, false, call->reply->ByteSizeLong(),
+                           [s, call]() { s->completeCall(call); });
+#else
+        s->completeCall(call);
+#endif
     }
 
 }
 
 void
 SundialRPCClient::AsyncCompleteRpc(SundialRPCClient * s, uint64_t
-node_id) {
+node_id, uint32_t cq_id) {
     void* got_tag;
     bool ok = false;
     // Block until the next result is available in the completion queue "cq".
     while (true) {
-        s->_servers[node_id]->cq_.Next(&got_tag, &ok);
+        s->_servers[node_id]->cqs_[cq_id].Next(&got_tag, &ok);
         // The tag in this example is the memory location of the call object
         auto call = static_cast<AsyncClientCall*>(got_tag);
         if (!call->status.ok()) {
             printf("[REQ] client rec response fail: (%d) %s\n",
                    call->status.error_code(), call->status.error_message().c_str());
             // assert(false);
+            // [PAXOS] the peer did not accept the entry
+            if (call->request->request_type() == SundialRequest::PAXOS_REPLICATE)
+                paxos_log->ack(call->request->log_index(), false);
+#if FAILURE_DETECTOR
+            // [FAILURE DETECTOR] the heartbeat expired; the next one is sent.
+            if (call->request->request_type() == SundialRequest::HEARTBEAT) {
+                failure_detector->heartbeat_failed(call->request->receiver_id());
+                delete call;
+            }
+#endif
             continue;
         }
-        // handle return value for non-system response
-        assert(call->reply->response_type() != SundialResponse::SYS_RESP);
-        s->sendRequestDone(call->request, call->reply);
-        // Once we're complete, deallocate the call object.
-        delete call;
+#if ZERO_COPY_TUPLES
+        if (call->raw_reader)
+            parseRawReply(call);
+#endif
+#if NET_EMULATION
+        s->_net_emu->delay(node_id, false, false, call->reply->ByteSizeLong(),
+                           [s, call]() { s->completeCall(call); });
+#else
+        s->completeCall(call);
+#endif
     }
 
 }
 
+void
+SundialRPCClient::completeCall(AsyncClientCall * call) {
+#if RPC_BATCHING
+    if (call->request->request_type() == SundialRequest::BATCH_REQ) {
+        sendBatchDone(call);
+        delete call;
+        return;
+    }
+#endif
+    // handle return value for non-system response
+    assert(call->reply->response_type() != SundialResponse::SYS_RESP);
+    sendRequestDone(call->request, call->reply);
+    // Once we're complete, deallocate the call object.
+    delete call;
+}
+
 RC
 SundialRPCClient::sendRequest(uint64_t node_id, SundialRequest &request,
     SundialResponse &response, bool is_storage) {
@@ -136,6 +216,15 @@ SundialRPCClient::sendRequest(uint64_t node_id, SundialRequest &request,
 #endif
     ClientContext context;
     request.set_request_time(get_sys_clock());
+    if (g_ts_alloc == TS_HLC)
+        request.set_hlc(glob_manager->get_hlc());
+#if NET_EMULATION
+    // the caller blocks anyway; wait until the request arrives.
+    uint64_t arrival_time = _net_emu->get_arrival_time(node_id, is_storage,
+        true, request.ByteSizeLong());
+    while (get_sys_clock() < arrival_time)
+        usleep(1);
+#endif
     Status status;
     if (!is_storage)
         status = _servers[node_id]->contactRemote(&context, request, &response);
@@ -147,6 +236,18 @@ SundialRPCClient::sendRequest(uint64_t node_id, SundialRequest &request,
                status.error_code(), status.error_message().c_str());
         assert(false);
     }
+    if (g_ts_alloc == TS_HLC)
+        glob_manager->update_hlc(response.hlc());
+#if CC_ALG == IDEAL_MVCC
+    if (!is_storage)
+        glob_manager->update_node_min_ts(node_id, response.min_ts());
+#endif
+#if NET_EMULATION
+    arrival_time = _net_emu->get_arrival_time(node_id, is_storage, false,
+                                              response.ByteSizeLong());
+    while (get_sys_clock() < arrival_time)
+        usleep(1);
+#endif
     uint64_t latency = get_sys_clock() - request.request_time();
     glob_stats->_stats[GET_THD_ID]->_req_msg_avg_latency[response
     .response_type()] += latency;
@@ -181,26 +282,97 @@ SundialRPCClient::sendRequestAsync(TxnManager * txn, uint64_t node_id,
     if ((is_storage && NODE_TYPE == STORAGE_NODE) || (!is_storage &&
     NODE_TYPE == COMPUTE_NODE))
         assert( node_id != g_node_id);
-    // call object to store rpc data
-    AsyncClientCall* call = new AsyncClientCall;;
     request.set_request_time(get_sys_clock());
     request.set_thread_id(GET_THD_ID);
+    if (g_ts_alloc == TS_HLC)
+        request.set_hlc(glob_manager->get_hlc());
     glob_stats->_stats[GET_THD_ID]->_req_msg_count[ request.request_type() ] ++;
     glob_stats->_stats[GET_THD_ID]->_req_msg_size[ request.request_type() ] += request.SpaceUsedLong();
+#if RPC_BATCHING
+    switch (request.request_type()) {
+        case SundialRequest::READ_REQ:
+        case SundialRequest::PREPARE_REQ:
+        case SundialRequest::COMMIT_REQ:
+        case SundialRequest::ABORT_REQ:
+    #if ZERO_COPY_TUPLES
+            // batches copy their requests
+            if (hasTupleRefs(request))
+                break;
+    #endif
+            if (!is_storage) {
+                addToBatch(node_id, request, response);
+                return RCOK;
+            }
+            break;
+        default:
+            break;
+    }
+#endif
+#if NET_EMULATION
+    _net_emu->delay(node_id, is_storage, true, getMessageSize(request),
+        [this, node_id, &request, &response, is_storage]() {
+            startCall(node_id, request, response, is_storage);
+        });
+#else
+    startCall(node_id, request, response, is_storage);
+#endif
+	return RCOK;
+}
+
+void
+SundialRPCClient::startCall(uint64_t node_id, SundialRequest &request,
+                            SundialResponse &response, bool is_storage)
+{
+    // may run on the emulator thread; use the cq of the sending thread.
+    uint64_t thd_id = request.thread_id();
+    // call object to store rpc data
+    AsyncClientCall* call = new AsyncClientCall;
+    // a failed node may never answer a heartbeat; fail it instead.
+    if (request.request_type() == SundialRequest::HEARTBEAT)
+        call->context.set_deadline(std::chrono::system_clock::now()
+            + std::chrono::microseconds(HEARTBEAT_TIMEOUT));
+#if ZERO_COPY_TUPLES
+    if (hasTupleRefs(request)) {
+        SundialRPCClientStub * server = is_storage? _storage_servers[node_id] :
+            _servers[node_id];
+        grpc::ByteBuffer buffer;
+        serializeByRef(request, &buffer);
+        call->raw_reader = server->generic_stub_->PrepareUnaryCall(
+            &call->context, "/sundial_rpc.SundialRPC/contactRemote", buffer,
+            server->get_cq(thd_id));
+        call->request = &request;
+        call->reply = &response;
+        call->raw_reader->StartCall();
+        call->raw_reader->Finish(&call->raw_reply, &(call->status), (void*)call);
+        return;
+    }
+#endif
     if (!is_storage)
         call->response_reader = _servers[node_id]->stub_->PrepareAsynccontactRemote(
-            &call->context, request, &_servers[node_id]->cq_);
+            &call->context, request, _servers[node_id]->get_cq(thd_id));
     else
         call->response_reader =
             _storage_servers[node_id]->stub_->PrepareAsynccontactRemote
-            (&call->context, request, &_storage_servers[node_id]->cq_);
+            (&call->context, request, _storage_servers[node_id]->get_cq(thd_id));
 
     // StartCall initiates the RPC call
     call->request = &request;
     call->response_reader->StartCall();
     call->reply = &response;
     call->response_reader->Finish(call->reply, &(call->status), (void*)call);
-	return RCOK;
+}
+
+uint64_t
+SundialRPCClient::getMessageSize(SundialRequest &request)
+{
+    uint64_t size = request.ByteSizeLong();
+#if ZERO_COPY_TUPLES
+    // the payloads are not in the message yet
+    if (hasTupleRefs(request))
+        for (int i = 0; i < request.tuple_data_size(); i++)
+            size += request.tuple_data(i).size();
+#endif
+    return size;
 }
 
 void
@@ -209,6 +381,13 @@ response)
 {
     // RACE CONDITION (solved): should assign thd id to server thread
     uint64_t thread_id = request->thread_id();
+    if (g_ts_alloc == TS_HLC)
+        glob_manager->update_hlc(response->hlc());
+#if CC_ALG == IDEAL_MVCC
+    // storage nodes leave it 0
+    if (response->min_ts() != 0)
+        glob_manager->update_node_min_ts(response->node_id(), response->min_ts());
+#endif
     uint64_t latency = get_sys_clock() - request->request_time();
     glob_stats->_stats[thread_id]->_req_msg_avg_latency[response->response_type()] += latency;
     if (latency > glob_stats->_stats[thread_id]->_req_msg_max_latency
@@ -245,9 +424,19 @@ response)
             case SundialResponse::PAXOS_LOG_ACK:
                 ((SemaphoreSync *) request->semaphore())->decr();
                 break;
+            case SundialResponse::PAXOS_REPLICATE_ACK:
+                paxos_log->ack(request->log_index(),
+                    response->response_type() != SundialResponse::RESP_FAIL);
+                break;
+            case SundialResponse::HEARTBEAT_ACK:
+                failure_detector->heard_from(response->node_id());
+                break;
             case SundialResponse::COMMIT_REQ:
                 txn = txn_table->get_txn(txn_id);
-                txn->rpc_semaphore->decr();
+                if (txn->is_async_commit())
+                    txn->release_async_commit();
+                else
+                    txn->rpc_semaphore->decr();
                 break;
             case SundialResponse::ABORT_REQ:
                 txn = txn_table->get_txn(txn_id);
@@ -266,3 +455,182 @@ response)
                 break;
         }
 }
+
+#if RPC_BATCHING
+void
+SundialRPCClient::addToBatch(uint64_t node_id, SundialRequest &request,
+                             SundialResponse &response)
+{
+    RPCBatch * batch = _batches[node_id];
+    pthread_mutex_lock(&batch->mutex);
+    if (batch->calls.empty())
+        batch->start_time = get_sys_clock();
+    batch->calls.push_back(std::make_pair(&request, &response));
+    if (batch->calls.size() >= RPC_BATCH_SIZE)
+        flushBatch(node_id);
+    pthread_mutex_unlock(&batch->mutex);
+}
+
+void
+SundialRPCClient::flushBatch(uint64_t node_id)
+{
+    RPCBatch * batch = _batches[node_id];
+    if (batch->calls.empty())
+        return;
+    AsyncClientCall* call = new AsyncClientCall;
+    call->request = new SundialRequest;
+    call->reply = new SundialResponse;
+    call->request->set_request_type(SundialRequest::BATCH_REQ);
+    call->request->set_request_time(get_sys_clock());
+    call->request->set_thread_id(GET_THD_ID);
+    for (auto &it : batch->calls)
+        call->request->add_batch()->CopyFrom(*it.first);
+    call->batch.swap(batch->calls);
+    INC_INT_STATS(num_rpc_batches, 1);
+    INC_INT_STATS(num_rpc_batched_reqs, call->batch.size());
+#if NET_EMULATION
+    _net_emu->delay(node_id, false, true, call->request->ByteSizeLong(),
+        [this, node_id, call]() { startBatchCall(node_id, call); });
+#else
+    startBatchCall(node_id, call);
+#endif
+}
+
+void
+SundialRPCClient::startBatchCall(uint64_t node_id, AsyncClientCall * call)
+{
+    call->response_reader = _servers[node_id]->stub_->PrepareAsynccontactRemote(
+        &call->context, *call->request,
+        _servers[node_id]->get_cq(call->request->thread_id()));
+    call->response_reader->StartCall();
+    call->response_reader->Finish(call->reply, &(call->status), (void*)call);
+}
+
+void
+SundialRPCClient::FlushBatches(SundialRPCClient * s)
+{
+    while (true) {
+        usleep(RPC_BATCH_TIMEOUT);
+        uint64_t now = get_sys_clock();
+        for (uint32_t i = 0; i < g_num_nodes; i++) {
+            if (i == g_node_id && NODE_TYPE == COMPUTE_NODE)
+                continue;
+            RPCBatch * batch = s->_batches[i];
+            pthread_mutex_lock(&batch->mutex);
+            if (!batch->calls.empty()
+                && now - batch->start_time >= RPC_BATCH_TIMEOUT * 1000UL)
+                s->flushBatch(i);
+            pthread_mutex_unlock(&batch->mutex);
+        }
+    }
+}
+
+void
+SundialRPCClient::sendBatchDone(AsyncClientCall * call)
+{
+    assert(call->reply->batch_size() == (int) call->batch.size());
+    for (uint32_t i = 0; i < call->batch.size(); i++) {
+        SundialResponse * response = call->batch[i].second;
+        response->Swap(call->reply->mutable_batch(i));
+        sendRequestDone(call->batch[i].first, response);
+    }
+    delete call->request;
+    delete call->reply;
+}
+#endif
+
+#if ZERO_COPY_TUPLES
+bool
+SundialRPCClient::hasTupleRefs(const SundialRequest &request)
+{
+    return request.tuple_data_size() > 0 && request.tuple_data(0).data_ref() != 0;
+}
+
+static void
+append_varint(string &buf, uint64_t value)
+{
+    while (value >= 0x80) {
+        buf.push_back((char) (value | 0x80));
+        value >>= 7;
+    }
+    buf.push_back((char) value);
+}
+
+void
+SundialRPCClient::serializeByRef(const SundialRequest &request, grpc::ByteBuffer * buffer)
+{
+    // the addresses are only meaningful locally. They are left out of the
+    // message, which holds the other fields of the request; the request
+    // itself is not changed, so that it can be sent again.
+    SundialRequest message(request);
+    vector<std::pair<const char *, uint64_t> > payloads;
+    for (int i = 0; i < request.tuple_data_size(); i++) {
+        const SundialRequest::TupleData &tuple = request.tuple_data(i);
+        payloads.push_back(std::make_pair(
+            reinterpret_cast<const char *>(tuple.data_ref()), tuple.size()));
+        message.mutable_tuple_data(i)->clear_data_ref();
+    }
+    // payload i follows the message as the i-th occurrence of the
+    // length-delimited field tuple_payload, so the receiver parses the buffer
+    // as a regular SundialRequest. Only the payloads are not copied; they
+    // live in the access set until the txn finishes, after the response.
+    string chunk;
+    message.SerializeToString(&chunk);
+    vector<grpc::Slice> slices;
+    for (auto &payload : payloads) {
+        append_varint(chunk, (SundialRequest::kTuplePayloadFieldNumber << 3) | 2);
+        append_varint(chunk, payload.second);
+        slices.push_back(grpc::Slice(chunk));
+        slices.push_back(grpc::Slice(payload.first, payload.second,
+                                     grpc::Slice::STATIC_SLICE));
+        chunk.clear();
+    }
+    grpc::ByteBuffer bytes(slices.data(), slices.size());
+    buffer->Swap(&bytes);
+}
+
+void
+SundialRPCClient::parseRawReply(AsyncClientCall * call)
+{
+    __attribute__((unused)) Status status =
+        grpc::SerializationTraits<SundialResponse>::Deserialize(
+            &call->raw_reply, call->reply);
+    assert(status.ok());
+}
+#endif
+
+void
+set_tuple_payload(SundialRequest::TupleData * tuple, char * data, uint64_t size)
+{
+#if ZERO_COPY_TUPLES
+    tuple->set_data_ref(reinterpret_cast<uint64_t>(data));
+#else
+    tuple->set_data(data, size);
+    INC_INT_STATS(num_tuple_bytes_copied, size);
+#endif
+}
+
+void
+set_tuple_payload(SundialResponse::TupleData * tuple, char * data, uint64_t size)
+{
+    tuple->set_data(data, size);
+    INC_INT_STATS(num_tuple_bytes_copied, size);
+}
+
+const string &
+get_tuple_payload(const SundialRequest * request, int i)
+{
+#if ZERO_COPY_TUPLES
+    return request->tuple_payload(i);
+#else
+    return request->tuple_data(i).data();
+#endif
+}
+
+void
+copy_tuple_payload(char * dest, const string &payload, uint64_t size)
+{
+    assert(payload.size() >= size);
+    memcpy(dest, payload.data(), size);
+    INC_INT_STATS(num_tuple_bytes_copied, size);
+}
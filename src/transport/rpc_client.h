@@ -1,12 +1,16 @@
 #pragma once
 
+#include "config.h"
 #include "sundial.grpc.pb.h"
 #include "sundial.pb.h"
 #include <iostream>
 #include <memory>
 #include <string>
 #include <grpcpp/grpcpp.h>
+#include <grpcpp/generic/generic_stub.h>
+#include <google/protobuf/arena.h>
 #include <thread>
+#include "net_emulator.h"
 
 using grpc::Channel;
 using grpc::ClientAsyncResponseReader;
@@ -17,6 +21,29 @@ using sundial_rpc::SundialRequest;
 using sundial_rpc::SundialResponse;
 using sundial_rpc::SundialRPC;
 
+// options of a message arena whose first block is the given buffer, so that
+// an arena which fits in it never touches the allocator.
+inline google::protobuf::ArenaOptions
+arena_options(char * block, size_t size) {
+    google::protobuf::ArenaOptions options;
+    options.initial_block = block;
+    options.initial_block_size = size;
+    return options;
+}
+
+// Tuple payloads. The copies made here, into a message or out of a received
+// one, are counted in num_tuple_bytes_copied. Copies inside protobuf
+// serialization and parsing are not.
+// attach data to a tuple. With ZERO_COPY_TUPLES, a request only keeps a
+// reference to it, which must stay valid until the request is sent.
+void set_tuple_payload(SundialRequest::TupleData * tuple, char * data,
+                       uint64_t size);
+void set_tuple_payload(SundialResponse::TupleData * tuple, char * data,
+                       uint64_t size);
+const std::string & get_tuple_payload(const SundialRequest * request, int i);
+// copy a received payload into an access-set buffer.
+void copy_tuple_payload(char * dest, const std::string &payload, uint64_t size);
+
 class TxnManager;
 struct AsyncClientCall {
     // Container for the data we expect from the server.
@@ -28,25 +55,55 @@ struct AsyncClientCall {
     // Storage for the status of the RPC upon completion.
     Status status;
     std::unique_ptr<ClientAsyncResponseReader<SundialResponse>> response_reader;
+    // [RPC BATCHING] the coalesced (request, response) pairs of a BATCH_REQ.
+    // request and reply are then owned by the call.
+    std::vector<std::pair<SundialRequest *, SundialResponse *> > batch;
+#if ZERO_COPY_TUPLES
+    // requests serialized by reference are sent through the generic stub;
+    // the reply is parsed into *reply on completion.
+    std::unique_ptr<ClientAsyncResponseReader<grpc::ByteBuffer>> raw_reader;
+    grpc::ByteBuffer raw_reply;
+#endif
 };
 
+#if RPC_BATCHING
+// async requests to one node waiting to be sent in one BATCH_REQ.
+struct RPCBatch {
+    pthread_mutex_t mutex;
+    std::vector<std::pair<SundialRequest *, SundialResponse *> > calls;
+    // arrival time of the oldest request
+    uint64_t        start_time;
+};
+#endif
+
 class SundialRPCClientStub {
 public:
-    SundialRPCClientStub (std::shared_ptr<Channel> channel) : stub_(SundialRPC::NewStub(channel)) {};
+    SundialRPCClientStub (std::shared_ptr<Channel> channel) : stub_(SundialRPC::NewStub(channel)) {
+#if ZERO_COPY_TUPLES
+        generic_stub_.reset(new grpc::GenericStub(channel));
+#endif
+    };
     Status contactRemote(ClientContext* context, SundialRequest &request, SundialResponse* response) {
 	    Status s = stub_->contactRemote(context, request, response);
 	    return s;
     };
     std::unique_ptr<SundialRPC::Stub> stub_;
-    // create a cq for each server
-    CompletionQueue cq_;
+#if ZERO_COPY_TUPLES
+    std::unique_ptr<grpc::GenericStub> generic_stub_;
+#endif
+    // NUM_RPC_CLIENT_CQS cqs for each server, each drained by its own thread.
+    // a worker thread always uses the same cq.
+    CompletionQueue cqs_[NUM_RPC_CLIENT_CQS];
+    CompletionQueue * get_cq(uint64_t thd_id) { return &cqs_[thd_id % NUM_RPC_CLIENT_CQS]; }
 };
 
 class SundialRPCClient {
 public:
     SundialRPCClient();
-    static void AsyncCompleteRpc(SundialRPCClient * s, uint64_t node_id);
-    static void AsyncCompleteRpcStorage(SundialRPCClient * s, uint64_t node_id);
+    static void AsyncCompleteRpc(SundialRPCClient * s, uint64_t node_id,
+                                 uint32_t cq_id);
+    static void AsyncCompleteRpcStorage(SundialRPCClient * s, uint64_t node_id,
+                                        uint32_t cq_id);
     RC sendRequest(uint64_t node_id, SundialRequest &request, SundialResponse
     &response, bool is_storage=false);
     RC sendRequestAsync(TxnManager * txn, uint64_t node_id,
@@ -54,8 +111,43 @@ public:
                           bool is_storage=false);
     void sendRequestDone(SundialRequest * request, SundialResponse *
     response);
+    // handle the reply of a completed async call and free the call.
+    void completeCall(AsyncClientCall * call);
+#if RPC_BATCHING
+    // send the batches whose oldest request waited RPC_BATCH_TIMEOUT.
+    static void FlushBatches(SundialRPCClient * s);
+    void addToBatch(uint64_t node_id, SundialRequest &request,
+                    SundialResponse &response);
+    // caller holds the latch of the batch.
+    void flushBatch(uint64_t node_id);
+    void sendBatchDone(AsyncClientCall * call);
+    void startBatchCall(uint64_t node_id, AsyncClientCall * call);
+    RPCBatch ** _batches;
+    std::thread * _flush_thread;
+#endif
     SundialRPCClientStub ** _servers;
     SundialRPCClientStub ** _storage_servers;
+    // NUM_RPC_CLIENT_CQS threads per server
     std::thread ** _threads;
     std::thread ** _storage_threads;
+#if NET_EMULATION
+    NetEmulator * _net_emu;
+#endif
+private:
+#if ZERO_COPY_TUPLES
+    // serialize a request whose tuples hold data_ref, referencing the
+    // payloads from the buffer instead of copying them.
+    static void serializeByRef(const SundialRequest &request, grpc::ByteBuffer * buffer);
+    static bool hasTupleRefs(const SundialRequest &request);
+    static void parseRawReply(AsyncClientCall * call);
+#endif
+    // issue an async call; the completion goes to the cq of the thread
+    // that sent the request.
+    void startCall(uint64_t node_id, SundialRequest &request,
+                   SundialResponse &response, bool is_storage);
+    static uint64_t getMessageSize(SundialRequest &request);
+    std::thread * start_cq_thread(bool is_storage, uint64_t node_id,
+                                  uint32_t cq_id);
+    // number of completion threads started so far, used to pick their cores.
+    uint32_t _num_cq_threads;
 };
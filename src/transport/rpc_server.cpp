@@ -4,13 +4,16 @@
 #include "txn_table.h"
 #include "manager.h"
 #include "redis_client.h"
+#include "local_log_client.h"
 #include "azure_blob_client.h"
+#include "paxos_log.h"
 
 /*
 SundialRPCServerImpl::~SundialRPCServerImpl(){
     server_->Shutdown();
-    // Always shutdown the completion queue after the server.
-    cq_->Shutdown();
+    // Always shutdown the completion queues after the server.
+    for (auto &cq : cqs_)
+        cq->Shutdown();
 }
 */
 
@@ -51,23 +54,30 @@ SundialRPCServerImpl::run() {
     ServerBuilder builder;
     builder.AddListeningPort(line, grpc::InsecureServerCredentials());
     builder.RegisterService(&service_);
-    cq_ = builder.AddCompletionQueue();
+    for (uint32_t i = 0; i < NUM_RPC_SERVER_CQS; i++)
+        cqs_[i] = builder.AddCompletionQueue();
     server_ = builder.BuildAndStart();
-    // set up multiple server threads to start accepting requests
-    // XXX(zhihan): only use one cq as it is thread safe. can switch to more cqs if does not scale 
+    // set up multiple server threads to start accepting requests.
+    // threads are spread over the completion queues, so a queue is only
+    // polled by NUM_RPC_SERVER_THREADS / NUM_RPC_SERVER_CQS threads.
     //_thread_pool = new pthread_t * [NUM_RPC_SERVER_THREADS];
     uint32_t num_thds = NUM_RPC_SERVER_THREADS;
+    assert(num_thds >= NUM_RPC_SERVER_CQS);
     _thread_pool = new std::thread * [num_thds];
     for (uint32_t i = 0; i < num_thds; i++) {
-        _thread_pool[i] = new std::thread(HandleRpcs, this, i + 1);
+        _thread_pool[i] = new std::thread(HandleRpcs, this, i + 1,
+                                          cqs_[i % NUM_RPC_SERVER_CQS].get());
+#if PIN_RPC_THREADS
+        pin_thread(_thread_pool[i], i);
+#endif
     }
     cout <<"[Sundial] rpc server initialized, listening on " << line << endl;
 }
 
 void SundialRPCServerImpl::HandleRpcs(SundialRPCServerImpl * s, uint32_t
-thd_id) {
+thd_id, ServerCompletionQueue * cq) {
     // Spawn a new CallData instance to serve new clients.
-    new CallData(&(s->service_), s->cq_.get(), thd_id);
+    CallData::Spawn(&(s->service_), cq, thd_id);
     void* tag;  // uniquely identifies a request.
     bool ok;
     while (true) {
@@ -76,9 +86,9 @@ thd_id) {
       // memory address of a CallData instance.
       // The return value of Next should always be checked. This return value
       // tells us whether there is any kind of event or cq_ is shutting down.
-      GPR_ASSERT(s->cq_->Next(&tag, &ok));
+      GPR_ASSERT(cq->Next(&tag, &ok));
       GPR_ASSERT(ok);
-      static_cast<CallData*>(tag)->Proceed(thd_id);
+      static_cast<RpcTag*>(tag)->Proceed(thd_id);
 
     }
 }
@@ -92,9 +102,9 @@ SundialRPCServerImpl::contactRemote(ServerContext* context, const SundialRequest
     return Status::OK;
 }
 
-void
-SundialRPCServerImpl::processContactRemote(ServerContext* context, const SundialRequest* request, 
-        SundialResponse* response) {
+bool
+SundialRPCServerImpl::processContactRemote(ServerContext* context, const SundialRequest* request,
+        SundialResponse* response, CallData * call, PostedRequest * posted) {
 
     uint64_t txn_id = request->txn_id();
     if ((int) request->request_type() <= (int) SundialResponse::TERMINATE_REQ) {
@@ -104,6 +114,17 @@ SundialRPCServerImpl::processContactRemote(ServerContext* context, const Sundial
     }
     response->set_txn_id(txn_id);
     response->set_node_id(g_node_id);
+    if (g_ts_alloc == TS_HLC) {
+        glob_manager->update_hlc(request->hlc());
+        response->set_hlc(glob_manager->get_hlc());
+    }
+#if CC_ALG == IDEAL_MVCC && NODE_TYPE == COMPUTE_NODE
+    response->set_min_ts(glob_manager->get_local_min_ts());
+#endif
+#if FAILURE_ENABLE
+    if (g_node_id == FAILURE_NODE && !glob_manager->active)
+        return processAsFailed(request, response);
+#endif
     RC rc = RCOK;
     TxnManager * txn;
     string data;
@@ -112,36 +133,90 @@ SundialRPCServerImpl::processContactRemote(ServerContext* context, const Sundial
     switch (request->request_type()) {
         case SundialRequest::SYS_REQ:
             glob_manager->receive_sync_request();
-            return;
-        case SundialRequest::READ_REQ:
-#if LOG_DELAY > 0
-            usleep(LOG_DELAY / 2);
+            return false;
+#if RPC_BATCHING
+        case SundialRequest::BATCH_REQ:
+            response->set_request_type(SundialResponse::BATCH_REQ);
+            for (int i = 0; i < request->batch_size(); i++)
+                response->add_batch()->set_thd_id(response->thd_id());
+            // the requests belong to different txns and can be reordered.
+            // Decisions go first so that a read or prepare in the batch does
+            // not wait for a lock released by a later request of the batch.
+            // Reads and prepares may block on a log write, so they are
+            // handed to the other rpc threads instead of served one by one.
+            {
+                assert(call);
+                uint32_t num_pending = 0;
+                for (int i = 0; i < request->batch_size(); i++) {
+                    SundialRequest::RequestType type = request->batch(i).request_type();
+                    if (type == SundialRequest::COMMIT_REQ
+                        || type == SundialRequest::ABORT_REQ) {
+                        __attribute__((unused)) bool deferred = processContactRemote(
+                            context, &request->batch(i), response->mutable_batch(i));
+                        assert(!deferred);
+                    } else
+                        num_pending ++;
+                }
+                if (num_pending == 0)
+                    return false;
+                auto pending = new std::atomic<uint32_t>(num_pending);
+                for (int i = 0; i < request->batch_size(); i++) {
+                    SundialRequest::RequestType type = request->batch(i).request_type();
+                    if (type != SundialRequest::COMMIT_REQ
+                        && type != SundialRequest::ABORT_REQ)
+                        new PostedRequest(call, &request->batch(i),
+                                          response->mutable_batch(i), pending);
+                }
+            }
+            return true;
 #endif
-            txn = txn_table->get_txn(txn_id);
+        case SundialRequest::READ_REQ:
+            // the txn is pinned while it is read, so that the failure
+            // detector does not terminate it meanwhile.
+            {
+                bool claimed;
+                txn = txn_table->pin_txn(txn_id, &claimed);
+                if (claimed) {
+                    // being terminated
+                    response->set_response_type(SundialResponse::RESP_ABORT);
+                    return false;
+                }
+            }
             if (txn  == nullptr) {
+                if (response->tuple_data_size() > 0) {
+                    // terminated while the read was blocked
+                    response->set_response_type(SundialResponse::RESP_ABORT);
+                    return false;
+                }
                 txn = new TxnManager();
                 txn->set_txn_id(txn_id);
-                txn_table->add_txn(txn);
+                txn_table->add_txn(txn, true);
             }
-            // for failure case
-            // only read and terminate need latch since
-            // (1) read can only be concurrent with read and terminate
-            // (2) read does not remove txn from txn table when getting txn
             rc = txn->process_read_request(request, response);
-            if (rc == ABORT) {
-                txn_table->remove_txn(txn);
-                delete txn;
+            if (rc == WAIT) {
+                // [IDEAL_MVCC] a committing writer blocks the read. The rest
+                // of it is served again later, so that the rpc thread, which
+                // the decision of the writer may need, is not held.
+                txn_table->unpin_txn(txn, false);
+                if (posted)
+                    posted->Repost(MVCC_READ_RETRY_DELAY);
+                else {
+                    assert(call);
+                    new PostedRequest(call, request, response, NULL,
+                                      MVCC_READ_RETRY_DELAY);
+                }
+                return true;
             }
+            // COMMIT: the sub-txn of a read-only txn ended with its reads.
+            if (txn_table->unpin_txn(txn, rc == ABORT || rc == COMMIT))
+                delete txn;
             response->set_txn_id(txn_id);
-#if LOG_DELAY > 0
-            usleep(LOG_DELAY / 2);
-#endif
             break;
         case SundialRequest::TERMINATE_REQ:
 #if NODE_TYPE == COMPUTE_NODE
-            txn = txn_table->get_txn(txn_id,true);
+            txn = txn_table->get_txn(txn_id, true, true);
             if (txn == nullptr) {
-                return;
+                return false;
             }
             txn->lock();
             rc = txn->process_terminate_request(request, response);
@@ -157,123 +232,103 @@ SundialRPCServerImpl::processContactRemote(ServerContext* context, const Sundial
 #if DEBUG_PRINT
             cout << "set active status to false" << endl;
 #endif
-            return;
+            return false;
 #endif
         case SundialRequest::PREPARE_REQ:
-#if LOG_DELAY > 0
-            usleep(LOG_DELAY / 2);
-#endif
 #if DEBUG_PRINT
           printf("[node-%u, txn-%lu] receive remote prepare request\n",
                  g_node_id, txn_id);
 #endif
-            txn = txn_table->get_txn(txn_id);
+            // a txn claimed by the failure detector is being aborted. The
+            // txn is pinned while it votes, so that it is not claimed then.
+            txn = txn_table->pin_txn(txn_id);
             if (txn == nullptr) {
                 // txn already cleaned up
                 response->set_response_type(SundialResponse::PREPARED_ABORT);
-                return;
+                return false;
             }
             txn->process_prepare_request(request, response);
-            if (txn->get_txn_state() != TxnManager::PREPARED) {
-                txn_table->remove_txn(txn);
+            if (txn_table->unpin_txn(txn, txn->get_txn_state() != TxnManager::PREPARED))
                 delete txn;
-            }
             response->set_txn_id(txn_id);
-#if LOG_DELAY > 0
-            usleep(LOG_DELAY / 2);
-#endif
             break;
         case SundialRequest::COMMIT_REQ:
-#if LOG_DELAY > 0
-            usleep(LOG_DELAY / 2);
-#endif
 #if DEBUG_PRINT
           printf("[node-%u, txn-%lu] receive remote commit request\n",
                  g_node_id, txn_id);
 #endif
-            txn = txn_table->get_txn(txn_id, true);
+            // claim the txn, so that the failure detector does not also
+            // terminate it.
+            txn = txn_table->get_txn(txn_id, true, true);
             if (txn == nullptr) {
                 response->set_response_type(SundialResponse::ACK);
-                return;
+                return false;
             }
             rc = txn->process_decision_request(request, response, COMMIT);
             txn_table->remove_txn(txn);
             delete txn;
             response->set_txn_id(txn_id);
-#if LOG_DELAY > 0
-            usleep(LOG_DELAY / 2);
-#endif
             break;
         case SundialRequest::ABORT_REQ:
-#if LOG_DELAY > 0
-            usleep(LOG_DELAY / 2);
-#endif
 #if DEBUG_PRINT
           printf("[node-%u txn-%lu] receive remote abort request\n",
                  g_node_id, txn_id);
 #endif
-            txn = txn_table->get_txn(txn_id, true);
+            txn = txn_table->get_txn(txn_id, true, true);
             if (txn == nullptr) {
                 response->set_response_type(SundialResponse::ACK);
-                return;
+                return false;
             }
             rc = txn->process_decision_request(request, response, ABORT);
             txn_table->remove_txn(txn);
             delete txn;
             response->set_txn_id(txn_id);
-#if LOG_DELAY > 0
-            usleep(LOG_DELAY / 2);
-#endif
             break;
         case  SundialRequest::PAXOS_LOG:
 #if DEBUG_PRINT
             printf("[node-%u txn-%lu] receive remote paxos log request\n",
                  g_node_id, txn_id);
 #endif
-#if LOG_DELAY > 0
-            usleep(LOG_DELAY / 2);
-#endif
-            // create the txn to use its semaphore
-            txn = new TxnManager();
-            txn->set_txn_id(txn_id);
-            txn->sendReplicateRequest(static_cast<TxnManager::State>(request->txn_state()),
-                                      request->log_data_size());
-            // forward request
+            // the rpc thread returns right away. Once logged, reply to
+            // participant or coordinator from the thread completing the log.
+            assert(call);
+            paxos_log->append(request, [call, request, response](bool ok) {
+                response->set_request_type(sundial_rpc::SundialResponse_RequestType_PAXOS_LOG_ACK);
+                if (!ok) {
+                    // the system is shutting down
+                    response->set_response_type(SundialResponse::RESP_FAIL);
+                    call->Finish();
+                    return;
+                }
 #if COMMIT_VAR == CORNUS_OPT
-            if (request->node_id() != request->coord_id() &&
-            request->forward_msg() != SundialRequest::ACK) {
+                // forward request
+                if (request->node_id() != request->coord_id() &&
+                request->forward_msg() != SundialRequest::ACK) {
 #if DEBUG_PRINT
-                printf("[txn-%lu] send paxos log forward request-%d from "
-                   "node-%lu\n", txn_id,
-                   request->forward_msg(), request->node_id());
-#endif
-                idx = request->thd_id() * g_num_nodes + request->node_id();
-                glob_manager->thd_requests_[idx].set_request_type
-                    (SundialRequest::PAXOS_LOG_FORWARD);
-                glob_manager->thd_requests_[idx].set_forward_msg(
-                    request->forward_msg());
-                glob_manager->thd_requests_[idx].set_txn_id(
-                    txn_id);
-                glob_manager->thd_requests_[idx].set_node_id
-                    (request->node_id());
-                rpc_client->sendRequestAsync(txn,
-                                         request->coord_id(),
-                                         glob_manager->thd_requests_[idx],
-                                         glob_manager->thd_responses_[idx],
-                                         false);
-            }
+                    printf("[txn-%lu] send paxos log forward request-%d from "
+                       "node-%lu\n", request->txn_id(),
+                       request->forward_msg(), request->node_id());
 #endif
-            delete txn;
-            // once logged, reply to participant or coordinator
-            response->set_request_type(sundial_rpc::SundialResponse_RequestType_PAXOS_LOG_ACK);
-#if LOG_DELAY > 0
-            usleep(LOG_DELAY / 2);
+                    size_t idx = request->thd_id() * g_num_nodes + request->node_id();
+                    glob_manager->thd_requests_[idx].set_request_type
+                        (SundialRequest::PAXOS_LOG_FORWARD);
+                    glob_manager->thd_requests_[idx].set_forward_msg(
+                        request->forward_msg());
+                    glob_manager->thd_requests_[idx].set_txn_id(
+                        request->txn_id());
+                    glob_manager->thd_requests_[idx].set_node_id
+                        (request->node_id());
+                    rpc_client->sendRequestAsync(nullptr,
+                                             request->coord_id(),
+                                             glob_manager->thd_requests_[idx],
+                                             glob_manager->thd_responses_[idx],
+                                             false);
+                }
 #endif
-            break;
+                call->Finish();
+            });
+            return true;
         case SundialRequest::PAXOS_LOG_FORWARD:
-#if LOG_DELAY > 0
-            usleep(LOG_DELAY / 2);
-#endif
             assert(request->forward_msg() != SundialRequest::RESP_OK);
             // response->set_request_type(SundialResponse::DummyReply);
             response->set_request_type(SundialResponse::PAXOS_FORWARD_ACK);
@@ -288,31 +343,29 @@ SundialRPCServerImpl::processContactRemote(ServerContext* context, const Sundial
                    "node-%lu and "
                    "decr txn semaphore\n", txn_id,
                    request->forward_msg(), request->node_id());
-#endif
-#if LOG_DELAY > 0
-            usleep(LOG_DELAY / 2);
 #endif
             break;
         case SundialRequest::PAXOS_REPLICATE:
-#if LOG_DELAY > 0
-            usleep(LOG_DELAY);
-#endif
 #if DEBUG_PRINT
             printf("[node-%u txn-%lu] receive remote paxos replicate\n",
                  g_node_id, txn_id);
 #endif
-            data = "[LSN] placehold:" + string(request->log_data_size(), 'd');
-            redis_client->log_sync_data(request->node_id(), request->txn_id(),
-                                        request->txn_state(), data);
-            // once logged, reply to participant or coordinator
-            response->set_request_type(sundial_rpc::SundialResponse_RequestType_PAXOS_LOG_ACK);
-            break;
+            // once the entry is accepted and its records applied, reply to
+            // the leader
+            response->set_request_type(SundialResponse::PAXOS_REPLICATE_ACK);
+            assert(call);
+            rc = PaxosLog::accept(*request, [call]() { call->Finish(); });
+            // not logged if the system is shutting down; the leader fails
+            // the entry.
+            if (rc != RCOK)
+                response->set_response_type(SundialResponse::RESP_FAIL);
+            return (rc == RCOK);
         case sundial_rpc::SundialRequest_RequestType_PAXOS_LOG_COLOCATE:
             data = "[LSN] placehold:" + string(request->log_data_size(), 'd');
+#if LOG_DEVICE == LOG_DVC_LOCAL_FILE
+            local_log_client->log_sync_data(request->node_id(), request->txn_id(), request->txn_state(), data);
+#else
             redis_client->log_sync_data(request->node_id(), request->txn_id(), request->txn_state(), data);
-#if LOG_DELAY > 0
-            if (request->receiver_id() != g_node_id || UNIFORM_DELAY)
-                usleep(LOG_DELAY / 2);
 #endif
             // once logged, reply to participant or coordinator
             response->set_request_type(sundial_rpc::SundialResponse_RequestType_PAXOS_LOG_ACK);
@@ -335,16 +388,9 @@ SundialRPCServerImpl::processContactRemote(ServerContext* context, const Sundial
                                              glob_manager->thd_responses_[idx],
                                              false);
             }
-#endif
-#if LOG_DELAY > 0
-            if (request->receiver_id() != g_node_id)
-                usleep(LOG_DELAY / 2);
 #endif
             break;
        case SundialRequest::PAXOS_LOG_COLOCATE_FORWARD:
-#if LOG_DELAY > 0
-            usleep(LOG_DELAY / 2);
-#endif
             assert(request->forward_msg() != SundialRequest::RESP_OK);
             // response->set_request_type(SundialResponse::DummyReply);
             response->set_request_type(SundialResponse::PAXOS_FORWARD_ACK);
@@ -359,40 +405,154 @@ SundialRPCServerImpl::processContactRemote(ServerContext* context, const Sundial
                    "node-%lu and "
                    "decr txn semaphore\n", txn_id,
                    request->forward_msg(), request->node_id());
-#endif
-#if LOG_DELAY > 0
-            usleep(LOG_DELAY / 2);
 #endif
             break;
+        case SundialRequest::HEARTBEAT:
+            response->set_request_type(SundialResponse::HEARTBEAT_ACK);
+            response->set_response_type(SundialResponse::ACK);
+            return false;
         default:
             assert(false);
     }
     // the transaction handles the RPC call
+    return false;
+}
+
+#if FAILURE_ENABLE
+bool
+SundialRPCServerImpl::processAsFailed(const SundialRequest* request,
+                                      SundialResponse* response) {
+    // the sub-txns of a failed node are lost before they voted, and its
+    // heartbeats stop. The other requests are still answered, so that the
+    // others do not wait on a node that is not coming back in this run.
+    switch (request->request_type()) {
+        case SundialRequest::SYS_REQ:
+            glob_manager->receive_sync_request();
+            return false;
+        case SundialRequest::HEARTBEAT:
+            // never replied to
+            return true;
+        case SundialRequest::READ_REQ:
+            response->set_response_type(SundialResponse::RESP_ABORT);
+            return false;
+        case SundialRequest::PREPARE_REQ:
+            response->set_response_type(SundialResponse::PREPARED_ABORT);
+            return false;
+#if RPC_BATCHING
+        case SundialRequest::BATCH_REQ:
+            // one response per request of the batch
+            response->set_request_type(SundialResponse::BATCH_REQ);
+            for (int i = 0; i < request->batch_size(); i++) {
+                const SundialRequest &item = request->batch(i);
+                SundialResponse * item_response = response->add_batch();
+                auto tpe = (SundialResponse::RequestType) ((int) item.request_type());
+                item_response->set_request_type(tpe);
+                item_response->set_txn_id(item.txn_id());
+                item_response->set_node_id(g_node_id);
+                item_response->set_thd_id(response->thd_id());
+                __attribute__((unused)) bool deferred = processAsFailed(
+                    &item, item_response);
+                assert(!deferred);
+            }
+            return false;
+#endif
+        default:
+            response->set_response_type(SundialResponse::ACK);
+            return false;
+    }
 }
+#endif
 
+std::vector<SundialRPCServerImpl::CallData *>
+SundialRPCServerImpl::CallData::free_calls_[NUM_RPC_SERVER_THREADS + 1];
 
 SundialRPCServerImpl::CallData::CallData(SundialRPC::AsyncService* service,
     ServerCompletionQueue* cq, uint32_t thd_id) : service_(service), cq_(cq),
+    arena_(arena_options(arena_block_, RPC_CALL_ARENA_SIZE)),
+    request_(google::protobuf::Arena::CreateMessage<SundialRequest>(&arena_)),
+    reply_(google::protobuf::Arena::CreateMessage<SundialResponse>(&arena_)),
     responder_(&ctx_), status_(CREATE) {
     Proceed(thd_id);
 }
 
+void
+SundialRPCServerImpl::CallData::Spawn(SundialRPC::AsyncService* service,
+    ServerCompletionQueue* cq, uint32_t thd_id) {
+    std::vector<CallData *> &free_calls = free_calls_[thd_id];
+    if (free_calls.empty()) {
+        new CallData(service, cq, thd_id);
+        return;
+    }
+    CallData * call = free_calls.back();
+    free_calls.pop_back();
+    // a thread only polls one cq, so the call was served on this one.
+    assert(call->service_ == service && call->cq_ == cq);
+    call->Reset();
+    call->Proceed(thd_id);
+}
+
+void
+SundialRPCServerImpl::CallData::Reset() {
+    // grpc contexts cannot be reused; construct them again in place.
+    responder_.~ServerAsyncResponseWriter<SundialResponse>();
+    ctx_.~ServerContext();
+    new (&ctx_) ServerContext();
+    new (&responder_) ServerAsyncResponseWriter<SundialResponse>(&ctx_);
+    arena_.Reset();
+    request_ = google::protobuf::Arena::CreateMessage<SundialRequest>(&arena_);
+    reply_ = google::protobuf::Arena::CreateMessage<SundialResponse>(&arena_);
+    status_ = CREATE;
+}
+
 void
 SundialRPCServerImpl::CallData::Proceed(uint32_t thd_id) {
     if (status_ == CREATE) {
         //ctx_.AsyncNotifyWhenDone(this);
-        service_->RequestcontactRemote(&ctx_, &request_, &responder_, cq_,
-                                       cq_, this);
+        service_->RequestcontactRemote(&ctx_, request_, &responder_, cq_,
+                                       cq_, (RpcTag *) this);
         status_ = PROCESS;
     } else if (status_ == PROCESS) {
         // Spawn a new CallData instance to serve new clients while processing
-        new CallData(service_, cq_, thd_id);
-        reply_.set_thd_id(thd_id);
-        processContactRemote(&ctx_, &request_ , &reply_);
+        Spawn(service_, cq_, thd_id);
+        reply_->set_thd_id(thd_id);
+        // a deferred response may be finished by another thread at any time.
         status_ = FINISH;
-        responder_.Finish(reply_, Status::OK, this);
+        if (!processContactRemote(&ctx_, request_ , reply_, this))
+            responder_.Finish(*reply_, Status::OK, (RpcTag *) this);
     } else  {
         GPR_ASSERT(status_ == FINISH);
-        delete this;
+        free_calls_[thd_id].push_back(this);
+    }
+}
+
+void
+SundialRPCServerImpl::CallData::Finish() {
+    assert(status_ == FINISH);
+    responder_.Finish(*reply_, Status::OK, (RpcTag *) this);
+}
+
+SundialRPCServerImpl::PostedRequest::PostedRequest(CallData * call,
+    const SundialRequest * request, SundialResponse * response,
+    std::atomic<uint32_t> * pending, uint64_t delay_us) : call_(call),
+    request_(request), response_(response), pending_(pending) {
+    Repost(delay_us);
+}
+
+void
+SundialRPCServerImpl::PostedRequest::Repost(uint64_t delay_us) {
+    // an expired alarm delivers the request to an rpc thread right away.
+    alarm_.Set(call_->get_cq(), gpr_time_add(gpr_now(GPR_CLOCK_MONOTONIC),
+        gpr_time_from_micros(delay_us, GPR_TIMESPAN)), (RpcTag *) this);
+}
+
+void
+SundialRPCServerImpl::PostedRequest::Proceed(uint32_t thd_id) {
+    // posted again
+    if (processContactRemote(NULL, request_, response_, NULL, this))
+        return;
+    if (pending_ == NULL || -- (*pending_) == 0) {
+        delete pending_;
+        call_->Finish();
     }
+    delete this;
 }
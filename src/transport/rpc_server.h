@@ -3,11 +3,16 @@
 #include "config.h"
 #include "sundial.grpc.pb.h"
 #include "sundial.pb.h"
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <string>
 #include <thread>
+#include <vector>
 #include <grpcpp/grpcpp.h>
+#include <grpcpp/alarm.h>
+#include <google/protobuf/arena.h>
+#include <atomic>
 
 using grpc::Server;
 using grpc::ServerAsyncResponseWriter;
@@ -20,14 +25,27 @@ using sundial_rpc::SundialResponse;
 using sundial_rpc::SundialRPC;
 
 class SundialRPCServerImpl final : public SundialRPC::Service {
+    class RpcTag;
+    class CallData;
+    class PostedRequest;
 public:
     void run();
-    static void HandleRpcs(SundialRPCServerImpl * s, uint32_t thd_id);
+    static void HandleRpcs(SundialRPCServerImpl * s, uint32_t thd_id,
+                           ServerCompletionQueue * cq);
     Status contactRemote(ServerContext * context, const SundialRequest* request,
                      SundialResponse* response) override;
-    static void processContactRemote(ServerContext* context, const SundialRequest* request,
-                     SundialResponse* response);
+    // return true if the response is sent later through call->Finish(),
+    // without holding the calling rpc thread. posted is set if the request
+    // is served apart from its call.
+    static bool processContactRemote(ServerContext* context, const SundialRequest* request,
+                     SundialResponse* response, CallData * call = NULL,
+                     PostedRequest * posted = NULL);
 private:
+#if FAILURE_ENABLE
+    // [FAILURE INJECTION] answer a request once this node has failed.
+    static bool processAsFailed(const SundialRequest* request,
+                                SundialResponse* response);
+#endif
     /*
     class RPCServerThread {
       public:
@@ -51,26 +69,71 @@ private:
         SundialResponse thd_responses2_[NUM_STORAGE_NODES];
     };
      */
-    class CallData {
+    // an event handled by an rpc thread.
+    class RpcTag {
+    public:
+        virtual ~RpcTag() {}
+        virtual void Proceed(uint32_t thd_id) = 0;
+    };
+    class CallData : public RpcTag {
     public:
         CallData(SundialRPC::AsyncService* service, ServerCompletionQueue* cq,
                  uint32_t thd_id);
-        void Proceed(uint32_t thd_id);
+        // wait for the next request on cq with a recycled CallData if the
+        // rpc thread has one.
+        static void Spawn(SundialRPC::AsyncService* service,
+                          ServerCompletionQueue* cq, uint32_t thd_id);
+        void Proceed(uint32_t thd_id) override;
+        // send a response deferred by processContactRemote.
+        void Finish();
+        ServerCompletionQueue * get_cq() { return cq_; }
     private:
+        // make a finished CallData ready to serve a new call.
+        void Reset();
         enum CallStatus { CREATE, PROCESS, FINISH };
         SundialRPC::AsyncService* service_;
         ServerCompletionQueue* cq_;
+        // request and reply live on arena_, which is emptied on reuse.
+        char arena_block_[RPC_CALL_ARENA_SIZE];
+        google::protobuf::Arena arena_;
         ServerContext ctx_;
-        SundialRequest request_;
-        SundialResponse reply_;
+        SundialRequest * request_;
+        SundialResponse * reply_;
         ServerAsyncResponseWriter<SundialResponse> responder_;
         CallStatus status_;
+        // finished CallData of each rpc thread (indexed by thd_id). A call is
+        // recycled by the thread that sees its FINISH event, so every list is
+        // only accessed by its own thread.
+        static std::vector<CallData *> free_calls_[NUM_RPC_SERVER_THREADS + 1];
+    };
+    // a request served by any rpc thread of the cq of its call, apart from
+    // the call: a READ/PREPARE of a BATCH_REQ [RPC BATCHING], so that the
+    // requests of a batch are served while the others block, or a READ_REQ
+    // blocked by a committing writer [IDEAL_MVCC], which is served again
+    // later. The last request of the call sends its reply.
+    class PostedRequest : public RpcTag {
+    public:
+        // pending is NULL if the request is the only one of the call.
+        PostedRequest(CallData * call, const SundialRequest * request,
+                      SundialResponse * response,
+                      std::atomic<uint32_t> * pending, uint64_t delay_us = 0);
+        void Proceed(uint32_t thd_id) override;
+        // serve the request again after delay_us.
+        void Repost(uint64_t delay_us);
+    private:
+        CallData * call_;
+        const SundialRequest * request_;
+        SundialResponse * response_;
+        // requests of the call not served yet
+        std::atomic<uint32_t> * pending_;
+        grpc::Alarm alarm_;
     };
     //pthread_t **    _thread_pool;
     std::thread **  _thread_pool;
     // RPCServerThread ** _thread_pool;
     SundialRPC::AsyncService service_;
     std::unique_ptr<Server> server_;
-    std::unique_ptr<ServerCompletionQueue> cq_;
+    // NUM_RPC_SERVER_CQS queues, each served by its own subset of threads
+    std::unique_ptr<ServerCompletionQueue> cqs_[NUM_RPC_SERVER_CQS];
 };
 
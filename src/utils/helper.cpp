@@ -1,5 +1,14 @@
 #include "global.h"
 #include "helper.h"
 #include "time.h"
+#include <sched.h>
 
-
+void pin_thread(std::thread * thd, uint32_t core)
+{
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(core % sysconf(_SC_NPROCESSORS_ONLN), &cpuset);
+    __attribute__((unused)) int rc = pthread_setaffinity_np(
+        thd->native_handle(), sizeof(cpu_set_t), &cpuset);
+    assert(rc == 0);
+}
@@ -4,6 +4,7 @@
 #include <iostream>
 #include <stdint.h>
 #include <chrono>
+#include <thread>
 #include "global.h"
 
 extern double g_cpu_freq;
@@ -154,6 +155,8 @@ extern double g_cpu_freq;
 #define ALIGNED(x) __attribute__ ((aligned(x)))
 
 int get_thdid_from_txnid(uint64_t txnid);
+// bind a thread to a core. core ids wrap around the online cores.
+void pin_thread(std::thread * thd, uint32_t core);
 
 //uint64_t key_to_part(uint64_t key);
 //uint64_t get_part_id(void * addr);
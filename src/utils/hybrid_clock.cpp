@@ -0,0 +1,37 @@
+#include <time.h>
+#include <algorithm>
+#include "hybrid_clock.h"
+
+const uint64_t HybridClock::EPOCH;
+
+uint64_t
+HybridClock::physical_time()
+{
+    // unlike get_sys_clock(), the same clock on all the nodes (up to NTP)
+    timespec tp;
+    clock_gettime(CLOCK_REALTIME, &tp);
+    return tp.tv_sec * 1000000000ULL + tp.tv_nsec - EPOCH;
+}
+
+uint64_t
+HybridClock::reserve(uint64_t n)
+{
+    uint64_t pt = physical_time();
+    uint64_t latest = _latest.load(std::memory_order_relaxed);
+    uint64_t start;
+    do {
+        start = std::max(latest + 1, pt);
+    } while (!_latest.compare_exchange_weak(latest, start + n - 1));
+    return start;
+}
+
+void
+HybridClock::update(uint64_t remote)
+{
+    uint64_t received = _received.load(std::memory_order_relaxed);
+    while (remote > received
+           && !_received.compare_exchange_weak(received, remote)) {}
+    uint64_t latest = _latest.load(std::memory_order_relaxed);
+    while (remote > latest
+           && !_latest.compare_exchange_weak(latest, remote)) {}
+}
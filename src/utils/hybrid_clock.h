@@ -0,0 +1,38 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+// Hybrid logical clock of a node (TS_ALLOC = TS_HLC).
+// A timestamp is the wall clock time in ns since EPOCH, unless a larger one
+// was issued or received already, in which case it is one more than that.
+// So the timestamps of a node only increase, stay close to the wall clock,
+// and a timestamp issued after receiving a message is larger than the
+// timestamps the message carried.
+// Only depends on the standard library, so that it can be benchmarked on its
+// own (tests/test_ts).
+class HybridClock {
+public:
+    HybridClock() : _latest(0), _received(0) {}
+
+    // a timestamp larger than all the ones issued or received
+    uint64_t        now() { return reserve(1); }
+    // reserve the n timestamps starting from the returned one
+    uint64_t        reserve(uint64_t n);
+    // fold in a timestamp carried by a message
+    void            update(uint64_t remote);
+
+    // the largest timestamp issued or received
+    uint64_t        latest() { return _latest.load(std::memory_order_relaxed); }
+    // the largest timestamp received; timestamps reserved earlier may be
+    // smaller and must no longer be issued.
+    uint64_t        received() { return _received.load(std::memory_order_relaxed); }
+
+    static uint64_t physical_time();
+    // 2024-01-01 00:00:00 UTC
+    static const uint64_t EPOCH = 1704067200ULL * 1000000000ULL;
+
+private:
+    std::atomic<uint64_t>   _latest;
+    std::atomic<uint64_t>   _received;
+};
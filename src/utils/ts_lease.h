@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include "hybrid_clock.h"
+
+// [TS_BATCH_ALLOC] Timestamps [next, end) reserved by a thread, handed out
+// one at a time without touching the shared counter or clock.
+// Only depends on the standard library, so that it can be benchmarked on its
+// own (tests/test_ts).
+struct TsLease {
+    uint64_t next;
+    uint64_t end;
+};
+
+// TS_CAS: refill the lease with one atomic add on the counter.
+inline uint64_t
+lease_cas_ts(TsLease & lease, uint64_t * counter, uint64_t n)
+{
+    if (lease.next == lease.end) {
+        lease.next = __sync_fetch_and_add(counter, n);
+        lease.end = lease.next + n;
+    }
+    return lease.next ++;
+}
+
+// TS_HLC: refill the lease from the clock. A lease taken before a message was
+// received may be below the timestamps it carried; it is dropped so that the
+// txns started after the message are ordered after them.
+inline uint64_t
+lease_hlc_ts(TsLease & lease, HybridClock & clock, uint64_t n)
+{
+    if (lease.next == lease.end || lease.next <= clock.received()) {
+        lease.next = clock.reserve(n);
+        lease.end = lease.next + n;
+    }
+    return lease.next ++;
+}
@@ -0,0 +1,65 @@
+# Correctness test of EARLY_CLIENT_ACK under a coordinator failure.
+# Runs exp_profiles/ycsb_failure_early_ack.json on a local cluster (see
+# run_local_cluster.py): node FAILURE_NODE fails FAILURE_TIMEPOINT seconds into
+# the run, and the failure detectors of the other nodes terminate the txns it
+# coordinated. A txn that was acked to the client must never be terminated
+# as an abort, and some acked txns must be terminated, or the run did not
+# test anything. The early acks and terminations are read from the
+# DEBUG_FAILURE output, which the test turns on whatever the profile or the
+# args say.
+# usage (from the repo root):
+# python3 tests/test_failure/test_early_ack.py [optional args]
+import os, re, sys
+
+repo = os.path.dirname(os.path.abspath(__file__)) + "/../../"
+sys.path.insert(0, repo)
+from run_exp import load_job, generate_args
+from run_local_cluster import run
+
+early_ack = re.compile(r"\[node-(\d+), txn-(\d+)\] early ack")
+terminated = re.compile(r"\[node-(\d+), txn-(\d+)\] terminated: (\w+)")
+
+
+def check(fnames):
+    acked = set()
+    aborted = []
+    terminated_txns = set()
+    num_terminated = 0
+    for fname in fnames:
+        for line in open(fname, errors="ignore"):
+            m = early_ack.search(line)
+            if m:
+                acked.add(int(m.group(2)))
+                continue
+            m = terminated.search(line)
+            if m:
+                num_terminated += 1
+                terminated_txns.add(int(m.group(2)))
+                if m.group(3) == "abort":
+                    aborted.append((int(m.group(1)), int(m.group(2))))
+    violations = [(node, txn) for (node, txn) in aborted if txn in acked]
+    for (node, txn) in violations:
+        print("[test_early_ack.py] txn-{} was acked but aborted on node-{}"
+              .format(txn, node))
+    overlap = acked & terminated_txns
+    print("[test_early_ack.py] {} early acks, {} terminated txns ({} aborted), "
+          "{} acked txns terminated"
+          .format(len(acked), num_terminated, len(aborted), len(overlap)),
+          flush=True)
+    if not overlap:
+        print("[test_early_ack.py] no acked txn was terminated")
+    return len(violations) == 0 and len(overlap) > 0
+
+
+if __name__ == "__main__":
+    os.chdir(repo)
+    os.makedirs(repo + "outputs", exist_ok=True)
+    job = load_job(["CONFIG=exp_profiles/ycsb_failure_early_ack.json"]
+                   + sys.argv[1:] + ["DEBUG_FAILURE=true"])
+    ok = True
+    for i, arg in enumerate(generate_args(job)):
+        arg += " EXP_ID={}".format(i)
+        print("[test_early_ack.py] arg = {}".format(arg), flush=True)
+        ok = run(load_job(arg.split()), check) and ok
+    print("[test_early_ack.py] " + ("PASS" if ok else "FAIL"))
+    sys.exit(0 if ok else 1)
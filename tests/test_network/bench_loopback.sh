@@ -0,0 +1,22 @@
+#!/bin/bash
+# RPC throughput on loopback: start N nodes on this machine, each keeping
+# BENCH_WINDOW async requests outstanding to every other node, and report
+# completed RPCs/sec in total and per core.
+# usage: ./bench_loopback.sh [num_nodes ...]   (default: 8 16 32)
+make -j16 > /dev/null || exit 1
+NODES=${@:-"8 16 32"}
+CORES=$(nproc)
+for n in $NODES; do
+    conf=ifconfig_loopback_$n.txt
+    rm -f $conf
+    for ((i = 0; i < n; i++)); do
+        echo "127.0.0.1:$((50051 + i))" >> $conf
+    done
+    for ((i = 0; i < n; i++)); do
+        ./run_test_network -Gn$i -GN$n -Gc$conf -Gb > bench_${n}_$i.log 2>&1 &
+    done
+    wait
+    total=$(grep -h "\[Bench\]" bench_${n}_*.log | awk '{s += $NF} END {print s}')
+    echo "$n nodes: $total rpcs/sec, $((total / CORES)) rpcs/sec/core ($CORES cores)"
+    rm -f $conf bench_${n}_*.log
+done
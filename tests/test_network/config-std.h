@@ -2,6 +2,13 @@
 
 #define NUM_NODES                       4
 #define NUM_RPC_SERVER_THREADS          4
+#define NUM_RPC_SERVER_CQS              1
+#define NUM_RPC_CLIENT_CQS              1
+#define PIN_RPC_THREADS                 false
+// loopback throughput benchmark (-Gb): each node keeps BENCH_WINDOW requests
+// outstanding to every other node for BENCH_TIME seconds.
+#define BENCH_WINDOW                    8
+#define BENCH_TIME                      10
 #define LOG_DEVICE                      LOG_DVC_NONE
 
 // Constants
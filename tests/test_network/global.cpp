@@ -15,6 +15,8 @@ char            ifconfig_file[80]       = "ifconfig.txt";
 uint32_t        g_num_nodes             = NUM_NODES;
 uint32_t        g_node_id               = NUM_NODES;
 uint32_t        g_num_rpc_recv = 0;
+bool            g_bench = false;
+volatile bool   g_bench_running = false;
 
 SundialRPCClient *  rpc_client;
 SundialRPCServerImpl * rpc_server;
@@ -23,3 +25,13 @@ RedisClient *       redis_client;
 #elif LOG_DEVICE == LOG_DVC_AZURE_BLOB
 AzureBlobClient *       azure_blob_client;
 #endif
+
+void pin_thread(std::thread * thd, uint32_t core)
+{
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(core % sysconf(_SC_NPROCESSORS_ONLN), &cpuset);
+    __attribute__((unused)) int rc = pthread_setaffinity_np(
+        thd->native_handle(), sizeof(cpu_set_t), &cpuset);
+    assert(rc == 0);
+}
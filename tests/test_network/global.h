@@ -27,6 +27,7 @@
 #include <time.h>
 #include <sys/time.h>
 #include <math.h>
+#include <thread>
 
 class SundialRPCClient;
 class SundialRPCServerImpl;
@@ -34,6 +35,8 @@ class SundialRPCServerImpl;
 extern uint32_t         g_num_nodes;
 extern uint32_t         g_node_id;
 extern uint32_t         g_num_rpc_recv;
+extern bool             g_bench;
+extern volatile bool    g_bench_running;
 
 extern char           ifconfig_file[];
 enum RC {RCOK, COMMIT, ABORT, WAIT, LOCAL_MISS, SPECULATE, ERROR, FINISH, FAIL};
@@ -46,6 +49,8 @@ extern RedisClient *      redis_client;
 extern AzureBlobClient *      azure_blob_client;
 #endif
 
+void pin_thread(std::thread * thd, uint32_t core);
+
 inline uint64_t get_sys_clock() {
 #if defined(__i386__)
     uint64_t ret;
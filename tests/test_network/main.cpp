@@ -2,6 +2,7 @@
 #include <fstream>
 #include <iostream>
 #include <unistd.h>
+#include <chrono>
 
 #include "global.h"
 #include "rpc_server.h"
@@ -19,6 +20,12 @@ int main(int argc, char* argv[])
         if (argv[i][1] == 'G') {
             if (argv[i][2] == 'n')
                 g_node_id = atoi( &argv[i][3] );
+            else if (argv[i][2] == 'N')
+                g_num_nodes = atoi( &argv[i][3] );
+            else if (argv[i][2] == 'c')
+                strcpy(ifconfig_file, &argv[i][3]);
+            else if (argv[i][2] == 'b')
+                g_bench = true;
         }
     }
 
@@ -39,8 +46,9 @@ int main(int argc, char* argv[])
     azure_blob_client = new AzureBlobClient();
 #endif
 
-    // make sure server is setup before moving on
-    sleep(30);
+    // make sure server is setup before moving on. Loopback nodes of the
+    // benchmark start together on the same machine.
+    sleep(g_bench ? 5 : 30);
 
     std::cout << "[Sundial] Synchronization starts on node " << g_node_id << std::endl;
     // Notify other nodes that the current node has finished initialization
@@ -57,6 +65,22 @@ int main(int argc, char* argv[])
     }
     while (g_num_rpc_recv < (g_num_nodes - 1) * num_iter) {
 	}
+
+    if (g_bench) {
+        auto start = std::chrono::steady_clock::now();
+        g_bench_running = true;
+        rpc_client->startBenchmark();
+        sleep(BENCH_TIME);
+        g_bench_running = false;
+        uint64_t num_done = rpc_client->getNumDone();
+        double secs = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+        std::cout << "[Bench] node " << g_node_id << " completed " << num_done
+                  << " rpcs in " << secs << " s, rpcs/sec: "
+                  << (uint64_t) (num_done / secs) << std::endl;
+        // let the outstanding requests of the other nodes drain before exit
+        sleep(2);
+    }
     return 0;
 }
 
@@ -25,23 +25,35 @@ SundialRPCClient::SundialRPCClient() {
         }
     }
     std::cout << "[Sundial] rpc client is initialized!" << std::endl;
-    // spawn a reader thread to indefinitely read completion queue
-    _thread = new std::thread(AsyncCompleteRpc, this);
-    // use a single cq for different channels.
+    // spawn one reader thread per cq to indefinitely read completion queue
+    for (uint32_t i = 0; i < NUM_RPC_CLIENT_CQS; i++) {
+        _num_done[i * 8] = 0;
+        _threads[i] = new std::thread(AsyncCompleteRpc, this, i);
+#if PIN_RPC_THREADS
+        pin_thread(_threads[i], NUM_RPC_SERVER_THREADS + i);
+#endif
+    }
 }
 
 void
-SundialRPCClient::AsyncCompleteRpc(SundialRPCClient * s) {
+SundialRPCClient::AsyncCompleteRpc(SundialRPCClient * s, uint32_t cq_id) {
     void* got_tag;
     bool ok = false;
     // Block until the next result is available in the completion queue "cq".
-    while (s->cq.Next(&got_tag, &ok)) {
+    while (s->cqs[cq_id].Next(&got_tag, &ok)) {
         // The tag in this example is the memory location of the call object
         AsyncClientCall* call = static_cast<AsyncClientCall*>(got_tag);
         if (!call->status.ok()) {
             printf("[REQ] client rec response fail: (%d) %s\n",
                    call->status.error_code(), call->status.error_message().c_str());
         }
+        if (call->bench) {
+            s->_num_done[cq_id * 8] ++;
+            if (g_bench_running)
+                s->sendBenchRequest(call->node_id, cq_id);
+            delete call;
+            continue;
+        }
         // handle return value for non-system response
         assert(call->reply->response_type() != SundialResponse::SYS_RESP);
         s->sendRequestDone(call->reply);
@@ -76,7 +88,9 @@ SundialRPCClient::sendRequestAsync(uint64_t node_id,
     // call object to store rpc data
     AsyncClientCall* call = new AsyncClientCall;;
     assert(node_id != g_node_id);
-    call->response_reader = _servers[node_id]->stub_->PrepareAsynccontactRemote(&call->context, request, &cq);
+    call->bench = false;
+    call->response_reader = _servers[node_id]->stub_->PrepareAsynccontactRemote(&call->context, request,
+        &cqs[node_id % NUM_RPC_CLIENT_CQS]);
 
     // StartCall initiates the RPC call
     call->response_reader->StartCall();
@@ -91,3 +105,38 @@ SundialRPCClient::sendRequestDone(SundialResponse * response)
 {
 
 }
+
+void
+SundialRPCClient::startBenchmark()
+{
+    for (uint32_t i = 0; i < g_num_nodes; i++) {
+        if (i == g_node_id) continue;
+        for (uint32_t w = 0; w < BENCH_WINDOW; w++)
+            sendBenchRequest(i, (i * BENCH_WINDOW + w) % NUM_RPC_CLIENT_CQS);
+    }
+}
+
+void
+SundialRPCClient::sendBenchRequest(uint64_t node_id, uint32_t cq_id)
+{
+    AsyncClientCall* call = new AsyncClientCall;
+    call->bench = true;
+    call->node_id = node_id;
+    SundialRequest request;
+    request.set_request_type(SundialRequest::READ_REQ);
+    request.set_node_id(g_node_id);
+    call->response_reader = _servers[node_id]->stub_->PrepareAsynccontactRemote(&call->context, request,
+        &cqs[cq_id]);
+    call->response_reader->StartCall();
+    call->reply = &call->bench_reply;
+    call->response_reader->Finish(call->reply, &(call->status), (void*)call);
+}
+
+uint64_t
+SundialRPCClient::getNumDone()
+{
+    uint64_t num_done = 0;
+    for (uint32_t i = 0; i < NUM_RPC_CLIENT_CQS; i++)
+        num_done += _num_done[i * 8];
+    return num_done;
+}
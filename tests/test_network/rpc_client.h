@@ -28,6 +28,11 @@ struct AsyncClientCall {
     // Storage for the status of the RPC upon completion.
     Status status;
     std::unique_ptr<ClientAsyncResponseReader<SundialResponse>> response_reader;
+    // benchmark calls own their reply and are re-issued to the same node on
+    // completion while the benchmark runs.
+    bool bench;
+    uint64_t node_id;
+    SundialResponse bench_reply;
 };
 
 class SundialRPCClientStub {
@@ -43,14 +48,21 @@ public:
 class SundialRPCClient {
 public:
     SundialRPCClient();
-    static void AsyncCompleteRpc(SundialRPCClient * s);
+    static void AsyncCompleteRpc(SundialRPCClient * s, uint32_t cq_id);
     RC sendRequest(uint64_t node_id, SundialRequest &request, SundialResponse
     &response);
     RC sendRequestAsync(uint64_t node_id,
                           SundialRequest &request, SundialResponse &response);
     void sendRequestDone(SundialResponse * response);
+    // closed-loop benchmark: keep BENCH_WINDOW requests outstanding to every
+    // other node until g_bench_running is cleared.
+    void startBenchmark();
+    uint64_t getNumDone();
 private:
+    void sendBenchRequest(uint64_t node_id, uint32_t cq_id);
     SundialRPCClientStub ** _servers;
-    CompletionQueue cq;
-    std::thread * _thread;
+    CompletionQueue cqs[NUM_RPC_CLIENT_CQS];
+    std::thread * _threads[NUM_RPC_CLIENT_CQS];
+    // completed benchmark requests per cq, one cache line apart.
+    uint64_t _num_done[NUM_RPC_CLIENT_CQS * 8];
 };
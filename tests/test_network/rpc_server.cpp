@@ -19,22 +19,28 @@ SundialRPCServerImpl::run() {
     ServerBuilder builder;
     builder.AddListeningPort(line, grpc::InsecureServerCredentials());
     builder.RegisterService(&service_);
-    cq_ = builder.AddCompletionQueue();
+    for (uint32_t i = 0; i < NUM_RPC_SERVER_CQS; i++)
+        cqs_[i] = builder.AddCompletionQueue();
     server_ = builder.BuildAndStart();
-    // set up multiple server threads to start accepting requests
-    // XXX(zhihan): only use one cq as it is thread safe. can switch to more cqs if does not scale 
+    // set up multiple server threads to start accepting requests. Threads are
+    // spread over NUM_RPC_SERVER_CQS completion queues.
     //_thread_pool = new pthread_t * [NUM_RPC_SERVER_THREADS];
     uint32_t num_thds = NUM_RPC_SERVER_THREADS;
     _thread_pool = new std::thread * [num_thds];
     for (uint32_t i = 0; i < num_thds; i++) {
-        _thread_pool[i] = new std::thread(HandleRpcs, this);
+        _thread_pool[i] = new std::thread(HandleRpcs, this,
+                                          cqs_[i % NUM_RPC_SERVER_CQS].get());
+#if PIN_RPC_THREADS
+        pin_thread(_thread_pool[i], i);
+#endif
     }
     std::cout <<"[Sundial] rpc server initialized, lisentening on " << line << std::endl;
 }
 
-void SundialRPCServerImpl::HandleRpcs(SundialRPCServerImpl * s) {
+void SundialRPCServerImpl::HandleRpcs(SundialRPCServerImpl * s,
+                                      ServerCompletionQueue * cq) {
     // Spawn a new CallData instance to serve new clients.
-    new CallData(&(s->service_), s->cq_.get());
+    new CallData(&(s->service_), cq);
     void* tag;  // uniquely identifies a request.
     bool ok;
     std::cout << "node " << g_node_id << " rpc thd starts" << std::endl;
@@ -44,7 +50,7 @@ void SundialRPCServerImpl::HandleRpcs(SundialRPCServerImpl * s) {
       // memory address of a CallData instance.
       // The return value of Next should always be checked. This return value
       // tells us whether there is any kind of event or cq_ is shutting down.
-      GPR_ASSERT(s->cq_->Next(&tag, &ok));
+      GPR_ASSERT(cq->Next(&tag, &ok));
       GPR_ASSERT(ok);
       static_cast<CallData*>(tag)->Proceed();
     }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "global.h"
 #include "sundial.grpc.pb.h"
 #include "sundial.pb.h"
 #include <iostream>
@@ -21,7 +22,7 @@ using sundial_rpc::SundialRPC;
 class SundialRPCServerImpl final : public SundialRPC::Service {
 public:
     void run();
-    static void HandleRpcs(SundialRPCServerImpl * s);
+    static void HandleRpcs(SundialRPCServerImpl * s, ServerCompletionQueue * cq);
     //void Export(net_http::HTTPServerInterface* http_server);
     Status contactRemote(ServerContext * context, const SundialRequest* request,
                      SundialResponse* response) override;
@@ -46,6 +47,6 @@ private:
     std::thread **  _thread_pool;
     SundialRPC::AsyncService service_;
     std::unique_ptr<Server> server_;
-    std::unique_ptr<ServerCompletionQueue> cq_;
+    std::unique_ptr<ServerCompletionQueue> cqs_[NUM_RPC_SERVER_CQS];
 };
 
@@ -0,0 +1,12 @@
+#!/bin/bash
+# Client and server CPU per log write at a fixed rate, for the old EVAL path
+# (script source and text keys on every call), EVALSHA with packed keys, and
+# MSET of BATCH statuses per call; then the abort-if-absent lookups of the
+# termination protocol, one txn per call and 16 per call.
+# usage: ./bench.sh [host:port] [rate]   (default: 127.0.0.1:6379 100000)
+make > /dev/null || exit 1
+ADDR=${1:-127.0.0.1:6379}
+RATE=${2:-100000}
+for mode in eval evalsha batch ifne ifne_batch; do
+    ./run_test_redis -a$ADDR -r$RATE -d10 -m$mode -b16
+done
@@ -0,0 +1,173 @@
+// Microbenchmark of the Redis log writes used by RedisClient: issues log
+// writes at a fixed rate and reports the CPU time per write on the client
+// (getrusage) and on the Redis server (INFO cpu).
+//   -aHOST:PORT  redis server (default 127.0.0.1:6379)
+//   -rINT        log writes per second (default 100000)
+//   -dINT        duration in seconds (default 10)
+//   -mMODE       eval    - EVAL with the script source and text keys
+//                evalsha - EVALSHA with binary-packed keys
+//                batch   - MSET of -b statuses per call
+//                ifne    - abort-if-absent of one status per call, as in the
+//                          termination protocol
+//                ifne_batch - abort-if-absent of -b statuses per call
+//   -bINT        writes per call in the batch modes (default 16)
+#include <cpp_redis/cpp_redis>
+#include <sys/resource.h>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+static const char * script = R"(
+        redis.call('set', KEYS[1], ARGV[1])
+        redis.call('set', KEYS[2], ARGV[2], 'NX')
+        return tonumber(redis.call('get', KEYS[2]))
+    )";
+
+static const char * ifne_script = R"(
+        local states = {}
+        for i = 1, #KEYS do
+            redis.call('set', KEYS[i], ARGV[1], 'NX')
+            states[i] = tonumber(redis.call('get', KEYS[i]))
+        end
+        return states
+    )";
+
+static std::string
+pack_key(char type, uint64_t node_id, uint64_t id) {
+    std::string key(1 + sizeof(uint32_t) + sizeof(uint64_t), type);
+    uint32_t node = node_id;
+    memcpy(&key[1], &node, sizeof(uint32_t));
+    memcpy(&key[1 + sizeof(uint32_t)], &id, sizeof(uint64_t));
+    return key;
+}
+
+static double
+client_cpu_us() {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1e6
+        + usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+}
+
+static double
+server_cpu_us(cpp_redis::client & client) {
+    double cpu = 0;
+    std::vector<std::string> command = {"INFO", "cpu"};
+    client.send(command, [&cpu](cpp_redis::reply & response) {
+        std::istringstream in(response.as_string());
+        std::string line;
+        while (std::getline(in, line)) {
+            if (line.find("used_cpu_sys:") == 0 || line.find("used_cpu_user:") == 0)
+                cpu += std::stod(line.substr(line.find(':') + 1)) * 1e6;
+        }
+    });
+    client.sync_commit();
+    return cpu;
+}
+
+int main(int argc, char * argv[]) {
+    std::string addr = "127.0.0.1:6379";
+    std::string mode = "evalsha";
+    uint64_t rate = 100000;
+    uint64_t duration = 10;
+    uint64_t batch = 16;
+    for (int i = 1; i < argc; i++) {
+        if (argv[i][0] != '-')
+            continue;
+        switch (argv[i][1]) {
+            case 'a': addr = &argv[i][2]; break;
+            case 'r': rate = atoll(&argv[i][2]); break;
+            case 'd': duration = atoll(&argv[i][2]); break;
+            case 'm': mode = &argv[i][2]; break;
+            case 'b': batch = atoll(&argv[i][2]); break;
+            default:
+                std::cout << "unknown option " << argv[i] << std::endl;
+                return 1;
+        }
+    }
+    if (mode != "batch" && mode != "ifne_batch")
+        batch = 1;
+    cpp_redis::client client;
+    client.connect(addr.substr(0, addr.find(':')),
+                   std::stoi(addr.substr(addr.find(':') + 1)));
+    std::string sha;
+    client.script_load(script, [&sha](cpp_redis::reply & response) {
+        sha = response.as_string();
+    });
+    std::string ifne_sha;
+    client.script_load(ifne_script, [&ifne_sha](cpp_redis::reply & response) {
+        ifne_sha = response.as_string();
+    });
+    client.sync_commit();
+
+    std::atomic<uint64_t> num_replies(0);
+    std::string data = "[LSN] placehold:" + std::string(32 * 8, 'd');
+    double client_start = client_cpu_us();
+    double server_start = server_cpu_us(client);
+    auto start = std::chrono::steady_clock::now();
+    uint64_t num_sent = 0;
+    uint64_t total = rate * duration;
+    // send what is due every 100us
+    while (num_sent < total) {
+        double elapsed = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+        uint64_t due = std::min(total, (uint64_t) (elapsed * rate));
+        while (num_sent < due) {
+            uint64_t txn_id = num_sent;
+            if (mode == "eval") {
+                std::string id = std::to_string(0) + "-" + std::to_string(txn_id);
+                std::vector<std::string> keys = {"data-" + id, "status" + id};
+                std::vector<std::string> args = {data, std::to_string(1)};
+                client.eval(script, keys, args, [&num_replies](cpp_redis::reply &) {
+                    num_replies ++;
+                });
+            } else if (mode == "evalsha") {
+                std::vector<std::string> keys = {pack_key('d', 0, txn_id),
+                                                 pack_key('s', 0, txn_id)};
+                std::vector<std::string> args = {data, std::string(1, '1')};
+                client.evalsha(sha, keys, args, [&num_replies](cpp_redis::reply &) {
+                    num_replies ++;
+                });
+            } else if (mode == "ifne" || mode == "ifne_batch") {
+                std::vector<std::string> keys;
+                for (uint64_t i = 0; i < batch; i++)
+                    keys.push_back(pack_key('s', 0, txn_id + i));
+                // ABORTED
+                std::vector<std::string> args = {std::string(1, '3')};
+                client.evalsha(ifne_sha, keys, args, [&num_replies, batch](cpp_redis::reply &) {
+                    num_replies += batch;
+                });
+            } else {
+                std::vector<std::string> command = {"MSET"};
+                for (uint64_t i = 0; i < batch; i++) {
+                    command.push_back(pack_key('s', 0, txn_id + i));
+                    command.push_back(std::string(1, '1'));
+                }
+                client.send(command, [&num_replies, batch](cpp_redis::reply &) {
+                    num_replies += batch;
+                });
+            }
+            num_sent += batch;
+        }
+        client.commit();
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    client.sync_commit();
+    while (num_replies < num_sent)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    double elapsed = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+    double client_cpu = client_cpu_us() - client_start;
+    double server_cpu = server_cpu_us(client) - server_start;
+
+    std::cout << "[Bench] mode=" << mode << " batch=" << batch
+              << " writes/sec=" << (uint64_t) (num_sent / elapsed)
+              << " client_us/write=" << client_cpu / num_sent
+              << " server_us/write=" << server_cpu / num_sent << std::endl;
+    return 0;
+}
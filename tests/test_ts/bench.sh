@@ -0,0 +1,17 @@
+#!/bin/bash
+# Timestamp allocation throughput from 1 to 256 threads: TS_MUTEX, TS_CAS one
+# timestamp per atomic, and TS_CAS with a per-thread lease of -b; then the
+# hybrid logical clock one timestamp at a time and with a lease, without and
+# with a remote clock update every 100 timestamps.
+# usage: ./bench.sh [duration in ms] [batch]   (default: 1000 64)
+make > /dev/null || exit 1
+DURATION=${1:-1000}
+BATCH=${2:-64}
+for mode in mutex cas cas_batch; do
+    ./run_test_ts -m$mode -d$DURATION -b$BATCH
+done
+for mode in hlc hlc_batch; do
+    for update in 0 100; do
+        ./run_test_ts -m$mode -d$DURATION -b$BATCH -u$update
+    done
+done
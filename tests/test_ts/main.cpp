@@ -0,0 +1,147 @@
+// Microbenchmark of the timestamp allocation of Manager::get_ts(): each thread
+// takes timestamps in a loop for a fixed time, and the throughput is reported
+// for 1, 2, 4, ... -t threads. Also checks that the timestamps of a thread
+// increase and are larger than the remote clock values folded in before them.
+//   -mMODE       mutex     - TS_MUTEX, a counter under a mutex
+//                cas       - TS_CAS, one atomic add per timestamp
+//                cas_batch - TS_CAS with TS_BATCH_ALLOC, one atomic add per
+//                            lease of -b timestamps
+//                hlc       - TS_HLC, one timestamp from the clock at a time
+//                hlc_batch - TS_HLC with TS_BATCH_ALLOC, a lease of -b
+//                            timestamps at a time
+//   -tINT        max number of threads (default 256)
+//   -dINT        duration of each run in ms (default 1000)
+//   -bINT        timestamps per lease (default 64)
+//   -uINT        [hlc] fold in a remote clock value every -u timestamps of
+//                a thread, as a message would (default 0, never)
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "hybrid_clock.h"
+#include "ts_lease.h"
+
+static HybridClock hlc;
+static std::string mode = "cas";
+static bool lease = false;
+static uint64_t batch = 64;
+static uint64_t update_every = 0;
+static std::atomic<bool> done(false);
+
+// the lease of Manager::get_ts()
+static thread_local TsLease ts_lease = {0, 0};
+
+// on its own cache line, as Manager::timestamp
+alignas(64) static uint64_t timestamp = 1;
+static std::mutex ts_mutex;
+
+static uint64_t
+get_mutex_ts() {
+    std::lock_guard<std::mutex> guard(ts_mutex);
+    return ++timestamp;
+}
+
+static uint64_t
+get_cas_ts() {
+    if (!lease)
+        return __sync_fetch_and_add(&timestamp, 1);
+    return lease_cas_ts(ts_lease, &timestamp, batch);
+}
+
+static uint64_t
+get_hlc_ts() {
+    if (!lease)
+        return hlc.now();
+    return lease_hlc_ts(ts_lease, hlc, batch);
+}
+
+static void
+run(uint64_t * count, uint64_t * violations) {
+    uint64_t n = 0;
+    uint64_t bad = 0;
+    uint64_t last = 0;
+    uint64_t (*get_ts)() = get_hlc_ts;
+    if (mode == "mutex")
+        get_ts = get_mutex_ts;
+    else if (mode == "cas" || mode == "cas_batch")
+        get_ts = get_cas_ts;
+    while (!done.load(std::memory_order_relaxed)) {
+        uint64_t ts = get_ts();
+        if (ts <= last)
+            bad ++;
+        last = ts;
+        n ++;
+        if (get_ts == get_hlc_ts && update_every > 0 && n % update_every == 0) {
+            // a message from a node whose wall clock is 10us ahead
+            last = HybridClock::physical_time() + 10000;
+            hlc.update(last);
+        }
+    }
+    *count = n;
+    *violations = bad;
+}
+
+int main(int argc, char * argv[]) {
+    uint64_t max_threads = 256;
+    uint64_t duration = 1000;
+    for (int i = 1; i < argc; i++) {
+        if (argv[i][0] != '-')
+            continue;
+        switch (argv[i][1]) {
+            case 'm': mode = &argv[i][2]; break;
+            case 't': max_threads = atoll(&argv[i][2]); break;
+            case 'd': duration = atoll(&argv[i][2]); break;
+            case 'b': batch = atoll(&argv[i][2]); break;
+            case 'u': update_every = atoll(&argv[i][2]); break;
+            default:
+                std::cout << "unknown option " << argv[i] << std::endl;
+                return 1;
+        }
+    }
+    if (mode != "mutex" && mode != "cas" && mode != "cas_batch"
+        && mode != "hlc" && mode != "hlc_batch") {
+        std::cout << "unknown mode " << mode << std::endl;
+        return 1;
+    }
+    lease = (mode == "cas_batch" || mode == "hlc_batch");
+    if (!lease)
+        batch = 1;
+
+    bool ok = true;
+    for (uint64_t num_threads = 1; num_threads <= max_threads; num_threads *= 2) {
+        std::vector<uint64_t> counts(num_threads);
+        std::vector<uint64_t> violations(num_threads);
+        std::vector<std::thread> threads;
+        done = false;
+        auto start = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < num_threads; i++)
+            threads.emplace_back(run, &counts[i], &violations[i]);
+        std::this_thread::sleep_for(std::chrono::milliseconds(duration));
+        done = true;
+        for (auto & t : threads)
+            t.join();
+        double elapsed = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+        uint64_t total = 0;
+        uint64_t bad = 0;
+        for (uint64_t i = 0; i < num_threads; i++) {
+            total += counts[i];
+            bad += violations[i];
+        }
+        ok = ok && bad == 0;
+        std::cout << "[Bench] mode=" << mode << " batch=" << batch
+                  << " threads=" << num_threads
+                  << " ts/sec=" << (uint64_t) (total / elapsed);
+        if (mode == "hlc" || mode == "hlc_batch") {
+            // how far the clock ran ahead of the wall clock
+            double drift_us = ((double) hlc.latest() - HybridClock::physical_time()) / 1000;
+            std::cout << " update=" << update_every << " drift_us=" << drift_us;
+        }
+        std::cout << " violations=" << bad << std::endl;
+    }
+    return ok ? 0 : 1;
+}